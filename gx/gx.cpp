@@ -2,7 +2,22 @@
 
 #include "gx/gx.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
@@ -10,9 +25,45 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#define GX_UNIX_SOCKETS
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GX_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
 
 #include <GLFW/glfw3.h>
 
+// The vendored implementation is not clean under -Wall -Wextra, its warnings are not ours to fix
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#elif defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
 template <typename Container, typename Iterator>
 void _container_unordered_remove(Container& c, Iterator it) {
     if (it == c.end()) return;
@@ -25,7 +76,31 @@ void _container_unordered_remove(Container& c, Iterator it) {
 
 typedef std::unordered_set<GXResource*> _app_resource_collection_t;
 typedef std::unordered_set<GXKeyboardCallback> _app_keyboard_callback_collection_t;
+typedef std::vector<uint8_t> _command_stream_t;
+typedef std::vector<GXSprite> _sprite_queue_t;
+
 
+static void _debug_forget_window(GXWindow* win);
+static void _shader_workers_destroy(void* share);
+static void _pending_program_release(GXPendingProgram* pending);
+static void _shader_watch_update(GLFWwindow* context);
+static void _shader_watch_forget(GXObject* object, GLFWwindow* context);
+static void _program_reflection_release(GXProgramReflection* reflection);
+static void _shader_variant_set_release(GXShaderVariantSet* set);
+static void _program_pipelines_forget(void* context);
+static void _program_pipelines_collect(void* context);
+static void _readback_ring_release(GXReadbackRing* ring);
+static void _capture_release(GXCapture* capture);
+static void _render_target_release(GXRenderTarget* target);
+static void _render_target_pool_forget(void* context);
+static void _render_target_pool_collect(void* context);
+static void _gpu_profiler_resolve(void* context);
+static void _gpu_profiler_forget(void* context);
+static void _render_graph_release(GXRenderGraph* graph);
+static void _dynamic_resolution_release(GXDynamicResolution* resolution);
+static void _software_renderer_release(GXSoftwareRenderer* renderer);
+static void _hitch_tracked_draw(GXObject* object, GXPrimitiveType primitive, uint32_t index_type, const std::function<void()>& draw);
+static void _hitch_forget_layout(GXObject* object);
 
 static GXResourceStatus operator|(GXResourceStatus lhs, GXResourceStatus rhs) {
     return static_cast<GXResourceStatus>(static_cast<int>(lhs) | static_cast<int>(rhs));
@@ -43,20 +118,38 @@ static GXResourceStatus& operator&=(GXResourceStatus& lhs, GXResourceStatus rhs)
 }
 
 static GXApplication* m_app = nullptr;
+// Window whose draw callback is currently running
+static GXWindow* m_current_window = nullptr;
+// Frames drawn by gxExec
+static uint64_t m_frame_index = 0;
+static bool m_hitch_tracking = false;
+// Render bundles referencing a resource, used to invalidate them when the resource is destroyed
+static std::unordered_map<GXResource*, std::unordered_set<GXRenderBundle*>> m_bundle_references;
 
-const char* gxInit() {
-    if (!glfwInit()) return "Failed to initialize GLFW";
+// Set when a headless application switched GLFW to the null platform
+static bool m_null_platform_forced = false;
+
+static bool _glfw_init(int platform) {
+    glfwInitHint(GLFW_PLATFORM, platform);
+    if (!glfwInit()) return false;
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 #ifdef __APPLE__
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+    return true;
+}
+
+const char* gxInit() {
+    // Machines without a display server still initialize, headless applications run on the null platform
+    if (!_glfw_init(GLFW_ANY_PLATFORM) && !_glfw_init(GLFW_PLATFORM_NULL)) return "Failed to initialize GLFW";
     return nullptr;
 }
 
 void gxTerminate() {
     if (m_app) gxDestroyApplication(m_app);
+    _shader_workers_destroy(nullptr);
     glfwTerminate();
 }
 
@@ -84,6 +177,17 @@ void gxDestroyApplication(GXApplication* application) {
 
 GXApplication* gxCreateApplication(GXApplicationOptions options) {
     if (m_app) gxDestroyApplication(m_app);
+    m_app = nullptr;
+
+    bool headless = options & GX_APP_OPTION_HEADLESS;
+    if (headless ? glfwGetPlatform() != GLFW_PLATFORM_NULL : m_null_platform_forced) {
+        _shader_workers_destroy(nullptr);
+        glfwTerminate();
+        m_null_platform_forced = headless;
+        bool initialized = headless ? _glfw_init(GLFW_PLATFORM_NULL) : _glfw_init(GLFW_ANY_PLATFORM) || _glfw_init(GLFW_PLATFORM_NULL);
+        if (!initialized) return nullptr;
+    }
+
     m_app = new GXApplication{};
     m_app->options = options;
     m_app->keyboard_cb_collection_vec_ptr = new _app_keyboard_callback_collection_t();
@@ -95,6 +199,33 @@ GXApplication* gxGetApplication() {
     return m_app;
 }
 
+bool gxIsHeadless() {
+    return m_app && (m_app->options & GX_APP_OPTION_HEADLESS);
+}
+
+// Headless contexts come from OSMesa or EGL on the null platform, software drivers such as llvmpipe may stop at OpenGL 4.5.
+// Shared contexts must be created through the API and version of the context they share with.
+static GLFWwindow* _create_glfw_window(int width, int height, const char* title, GLFWwindow* share = nullptr) {
+    if (!gxIsHeadless()) return glfwCreateWindow(width, height, title, nullptr, share);
+
+    std::vector<std::pair<int, int>> attempts;
+    if (share) {
+        attempts.push_back({ glfwGetWindowAttrib(share, GLFW_CONTEXT_CREATION_API), glfwGetWindowAttrib(share, GLFW_CONTEXT_VERSION_MINOR) });
+    } else {
+        attempts = { { GLFW_OSMESA_CONTEXT_API, 6 }, { GLFW_OSMESA_CONTEXT_API, 5 }, { GLFW_EGL_CONTEXT_API, 6 }, { GLFW_EGL_CONTEXT_API, 5 } };
+    }
+
+    GLFWwindow* window = nullptr;
+    for (size_t i = 0; i < attempts.size() && !window; i++) {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, attempts[i].first);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, attempts[i].second);
+        window = glfwCreateWindow(width, height, title, nullptr, share);
+    }
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_NATIVE_CONTEXT_API);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+    return window;
+}
+
 void gxExec() {
     if (!m_app) return;
 
@@ -154,15 +285,23 @@ void gxExec() {
 
             glfwWin = static_cast<GLFWwindow*>(win->internal);
             glfwMakeContextCurrent(glfwWin);
+            _shader_watch_update(glfwWin);
+            _program_pipelines_collect(glfwWin);
+            _render_target_pool_collect(glfwWin);
+            _gpu_profiler_resolve(glfwWin);
 
             glfwGetFramebufferSize(glfwWin, &width, &height);
             win->width = width;
             win->height = height;
 
+            m_current_window = win;
             win->draw_callback(win);
+            gxDebugFlush();
+            m_current_window = nullptr;
 
             glfwSwapBuffers(glfwWin);
         }
+        m_frame_index++;
     }
 }
 
@@ -197,13 +336,117 @@ GXObject* gxCreateRenderObject(uint32_t shader_program, GXBufferUsageType vert_b
 }
 
 void gxDrawVertices(GXObject* object, size_t offset, size_t count) {
-    gxBindVertexArrayObject(object->vao);
-    glDrawArrays(GL_TRIANGLES, offset, count);
+    gxDrawPrimitives(object, GX_PRIMITIVE_TRIANGLES, offset, count);
 }
 
 void gxDrawElements(GXObject* object, size_t count, GXVertexAttributeType type) {
+    gxDrawPrimitiveElements(object, GX_PRIMITIVE_TRIANGLES, count, type);
+}
+
+void gxDrawPrimitives(GXObject* object, GXPrimitiveType primitive, size_t offset, size_t count) {
+    gxBindVertexArrayObject(object->vao);
+    if (m_hitch_tracking) _hitch_tracked_draw(object, primitive, 0, [&] { glDrawArrays(primitive, offset, count); });
+    else glDrawArrays(primitive, offset, count);
+}
+
+void gxDrawPrimitiveElements(GXObject* object, GXPrimitiveType primitive, size_t count, GXVertexAttributeType type) {
     gxBindVertexArrayObject(object->vao);
-    glDrawElements(GL_TRIANGLES, count, type, nullptr);
+    if (m_hitch_tracking) _hitch_tracked_draw(object, primitive, type, [&] { glDrawElements(primitive, count, type, nullptr); });
+    else glDrawElements(primitive, count, type, nullptr);
+}
+
+void gxEnablePrimitiveRestart(uint32_t restart_index) {
+    glDisable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+    glEnable(GL_PRIMITIVE_RESTART);
+    glPrimitiveRestartIndex(restart_index);
+}
+
+void gxEnablePrimitiveRestartFixedIndex() {
+    glDisable(GL_PRIMITIVE_RESTART);
+    glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+}
+
+void gxDisablePrimitiveRestart() {
+    glDisable(GL_PRIMITIVE_RESTART);
+    glDisable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+}
+
+static uint64_t _strip_edge_key(uint32_t from, uint32_t to) { return (uint64_t(from) << 32) | to; }
+
+size_t gxStripifyTriangles(const uint32_t* indices, size_t index_count, uint32_t restart_index, uint32_t* out_indices, size_t out_capacity) {
+    if (!indices) return 0;
+    size_t triangle_count = index_count / 3;
+
+    // Directed edge -> triangles that contain it in their winding order
+    std::unordered_map<uint64_t, std::vector<uint32_t>> edge_triangles;
+    edge_triangles.reserve(triangle_count * 3);
+    std::vector<uint32_t> used(triangle_count, 0); // 0 = free, 1 = emitted, otherwise the stamp of a trial strip
+    for (size_t t = 0; t < triangle_count; t++) {
+        const uint32_t* v = indices + t * 3;
+        if (v[0] == v[1] || v[1] == v[2] || v[2] == v[0]) {
+            used[t] = 1;
+            continue;
+        }
+        for (int e = 0; e < 3; e++) edge_triangles[_strip_edge_key(v[e], v[(e + 1) % 3])].push_back((uint32_t)t);
+    }
+
+    // A strip triangle k is (s[k], s[k+1], s[k+2]) for even k and (s[k+1], s[k], s[k+2]) for odd k,
+    // so the next triangle must contain the directed edge s[n-2]->s[n-1] (even) or s[n-1]->s[n-2] (odd).
+    auto find_next = [&](const std::vector<uint32_t>& strip, uint32_t stamp, uint32_t& next_triangle, uint32_t& next_vertex) {
+        size_t n = strip.size();
+        bool even = ((n - 2) % 2) == 0;
+        uint32_t from = even ? strip[n - 2] : strip[n - 1];
+        uint32_t to = even ? strip[n - 1] : strip[n - 2];
+        auto it = edge_triangles.find(_strip_edge_key(from, to));
+        if (it == edge_triangles.end()) return false;
+        for (uint32_t t : it->second) {
+            if (used[t] == 1 || used[t] == stamp) continue;
+            const uint32_t* v = indices + t * 3;
+            for (int e = 0; e < 3; e++) {
+                if (v[e] == from && v[(e + 1) % 3] == to) {
+                    next_triangle = t;
+                    next_vertex = v[(e + 2) % 3];
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    std::vector<uint32_t> result, strip, best, strip_triangles, best_triangles;
+    result.reserve(index_count);
+    uint32_t stamp = 2; // Every trial strip gets a unique stamp, so trial marks never need to be cleared
+    for (size_t t = 0; t < triangle_count; t++) {
+        if (used[t] == 1) continue;
+        const uint32_t* v = indices + t * 3;
+
+        // Try every rotation of the seed triangle and keep the longest strip
+        best.clear();
+        for (int rotation = 0; rotation < 3; rotation++, stamp++) {
+            strip.assign({ v[rotation], v[(rotation + 1) % 3], v[(rotation + 2) % 3] });
+            strip_triangles.assign(1, (uint32_t)t);
+            used[t] = stamp;
+            uint32_t next_triangle, next_vertex;
+            while (find_next(strip, stamp, next_triangle, next_vertex)) {
+                used[next_triangle] = stamp;
+                strip_triangles.push_back(next_triangle);
+                strip.push_back(next_vertex);
+            }
+            if (strip.size() > best.size()) {
+                best.swap(strip);
+                best_triangles.swap(strip_triangles);
+            }
+        }
+        for (uint32_t emitted : best_triangles) used[emitted] = 1;
+
+        if (!result.empty()) result.push_back(restart_index);
+        result.insert(result.end(), best.begin(), best.end());
+    }
+
+    if (!out_indices) return result.size();
+    if (result.size() > out_capacity) return 0;
+    memcpy(out_indices, result.data(), result.size() * sizeof(uint32_t));
+    return result.size();
 }
 
 void gxBindObject(GXObject* object) {
@@ -229,7 +472,7 @@ GXWindow* gxCreateWindow(bool vsync, bool show, int width, int height, const cha
     GLFWwindow* glfwWin = nullptr;
 
     *window = { resource, width, height, title, show, nullptr, nullptr };
-    window->internal = glfwWin = glfwCreateWindow(width, height, title, nullptr, nullptr);
+    window->internal = glfwWin = _create_glfw_window(width, height, title);
 
     if (!window->internal) {
         delete resource;
@@ -257,7 +500,10 @@ GXWindow* gxCreateWindow(bool vsync, bool show, int width, int height, const cha
         [](GLFWwindow* gw) {
             if (GXResource* res = static_cast<GXResource*>(glfwGetWindowUserPointer(gw))) {
                 GXWindow* win = gxAsWindow(res);
+                m_current_window = win;
                 win->draw_callback(win);
+                gxDebugFlush();
+                m_current_window = nullptr;
                 glfwSwapBuffers(gw);
             }
         });
@@ -306,18 +552,126 @@ bool gxDestroyResource(GXResource* resource) {
     
     resource_collection->erase(resource);
 
+    auto references = m_bundle_references.find(resource);
+    if (references != m_bundle_references.end()) {
+        for (GXRenderBundle* bundle : references->second) bundle->valid = false;
+        m_bundle_references.erase(references);
+    }
+
     switch (resource->type) {
     case GX_RESOURCE_WINDOW:
         if (auto win = gxAsWindow(resource)) {
+            _debug_forget_window(win);
+            // The workers flush their reload jobs when destroyed, the results are dropped with the watches afterwards
+            _shader_workers_destroy(win->internal);
+            _shader_watch_forget(nullptr, static_cast<GLFWwindow*>(win->internal));
+            _program_pipelines_forget(win->internal);
+            _render_target_pool_forget(win->internal);
+            _gpu_profiler_forget(win->internal);
             glfwDestroyWindow(static_cast<GLFWwindow*>(win->internal));
         }
         break;
     case GX_RESOURCE_OBJECT:
         if (auto obj = gxAsObject(resource)) {
+            _shader_watch_forget(obj, nullptr);
+            _hitch_forget_layout(obj);
             if (obj->vao) glDeleteVertexArrays(1, &obj->vao);
             if (obj->vbo) glDeleteBuffers(1, &obj->vbo);
             if (obj->ebo) glDeleteBuffers(1, &obj->ebo);
         }
+        break;
+    case GX_RESOURCE_CULLING_STAGE:
+        if (auto stage = gxAsCullingStage(resource)) {
+            if (stage->cull_program) glDeleteProgram(stage->cull_program);
+            uint32_t buffers[] = { stage->bounds_buffer, stage->visible_buffer, stage->command_buffer };
+            glDeleteBuffers(3, buffers);
+            delete stage;
+        }
+        break;
+    case GX_RESOURCE_COMMAND_LIST:
+        if (auto list = gxAsCommandList(resource)) {
+            delete (_command_stream_t*)list->stream_ptr;
+            delete list;
+        }
+        break;
+    case GX_RESOURCE_RENDER_BUNDLE:
+        if (auto bundle = gxAsRenderBundle(resource)) {
+            auto objects = (std::unordered_set<GXResource*>*)bundle->objects_ptr;
+            for (GXResource* object : *objects) {
+                auto it = m_bundle_references.find(object);
+                if (it != m_bundle_references.end()) it->second.erase(bundle);
+            }
+            if (bundle->indirect_buffer) glDeleteBuffers(1, &bundle->indirect_buffer);
+            delete objects;
+            delete (_command_stream_t*)bundle->stream_ptr;
+            delete bundle;
+        }
+        break;
+    case GX_RESOURCE_SPRITE_BATCH:
+        if (auto batch = gxAsSpriteBatch(resource)) {
+            glDeleteProgram(batch->default_program);
+            glDeleteTextures(1, &batch->white_texture);
+            glDeleteVertexArrays(1, &batch->vao);
+            uint32_t buffers[] = { batch->vbo, batch->ebo };
+            glDeleteBuffers(2, buffers);
+            delete (_sprite_queue_t*)batch->sprites_ptr;
+            delete batch;
+        }
+        break;
+    case GX_RESOURCE_PENDING_PROGRAM:
+        if (auto pending = gxAsPendingProgram(resource)) {
+            _pending_program_release(pending);
+            delete pending;
+        }
+        break;
+    case GX_RESOURCE_PROGRAM_REFLECTION:
+        if (auto reflection = gxAsProgramReflection(resource)) {
+            _program_reflection_release(reflection);
+            delete reflection;
+        }
+        break;
+    case GX_RESOURCE_SHADER_VARIANT_SET:
+        if (auto set = gxAsShaderVariantSet(resource)) {
+            _shader_variant_set_release(set);
+            delete set;
+        }
+        break;
+    case GX_RESOURCE_READBACK_RING:
+        if (auto ring = gxAsReadbackRing(resource)) {
+            _readback_ring_release(ring);
+            delete ring;
+        }
+        break;
+    case GX_RESOURCE_CAPTURE:
+        if (auto capture = gxAsCapture(resource)) {
+            _capture_release(capture);
+            delete capture;
+        }
+        break;
+    case GX_RESOURCE_RENDER_TARGET:
+        if (auto target = gxAsRenderTarget(resource)) {
+            _render_target_release(target);
+            delete target;
+        }
+        break;
+    case GX_RESOURCE_RENDER_GRAPH:
+        if (auto graph = gxAsRenderGraph(resource)) {
+            _render_graph_release(graph);
+            delete graph;
+        }
+        break;
+    case GX_RESOURCE_DYNAMIC_RESOLUTION:
+        if (auto resolution = gxAsDynamicResolution(resource)) {
+            _dynamic_resolution_release(resolution);
+            delete resolution;
+        }
+        break;
+    case GX_RESOURCE_SOFTWARE_RENDERER:
+        if (auto renderer = gxAsSoftwareRenderer(resource)) {
+            _software_renderer_release(renderer);
+            delete renderer;
+        }
+        break;
     }
     delete resource;
 
@@ -348,22 +702,231 @@ GXShaderCompilationResult gxCompileGLSLShader(const char* shader_src, GXShaderTy
     return result;
 }
 
-GXProgramCompilationResult gxCompileGLSLProgram(const char* vertex_shader_src, const char* fragment_shader_src) {
+struct _program_stage_t {
+    const char* src;
+    GXShaderType type;
+    GXShaderCompilationResult* result;
+};
+
+struct _program_cache_t {
+    bool enabled = false;
+    std::filesystem::path directory;
+    std::mutex mutex; // Guards every member, programs are also compiled by the shader worker threads
+    GXProgramCacheStats stats = {};
+};
+static _program_cache_t m_program_cache;
+
+static const uint32_t _PROGRAM_CACHE_MAGIC = 0x42505847; // "GXPB"
+static const uint32_t _PROGRAM_CACHE_VERSION = 2;
+
+static uint64_t _fnv1a(uint64_t hash, const void* data, size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// The file name only holds 64 bits of the key, a second hash and the hashed length are stored in the entry so a collision is rejected
+struct _program_cache_key_t {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    uint64_t check = 0x6C62272E07BB0142ull;
+    uint64_t length = 0;
+    std::filesystem::path directory;  // Copied under the cache mutex, the cache may be moved while workers compile
+
+    void add(const void* data, size_t size) {
+        hash = _fnv1a(hash, data, size);
+        check = _fnv1a(check, data, size);
+        length += size;
+    }
+    std::filesystem::path path() const {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(hash));
+        return directory / name;
+    }
+};
+
+struct _program_cache_header_t {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t check;
+    uint64_t length;
+    uint32_t format;
+    uint32_t reserved;
+};
+
+// Every key starts from the driver identity, so a driver update never loads a stale binary
+static _program_cache_key_t _program_cache_seed() {
+    _program_cache_key_t key;
+    for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+        const char* str = reinterpret_cast<const char*>(glGetString(name));
+        if (str) key.add(str, strlen(str) + 1);
+    }
+    return key;
+}
+
+static _program_cache_key_t _program_cache_key(const _program_stage_t* stages, size_t count, bool separable) {
+    _program_cache_key_t key = _program_cache_seed();
+    key.add(&separable, sizeof(separable));
+    for (size_t i = 0; i < count; i++) {
+        key.add(&stages[i].type, sizeof(stages[i].type));
+        key.add(stages[i].src, strlen(stages[i].src) + 1);
+    }
+    return key;
+}
+
+static bool _program_cache_load(const _program_cache_key_t& key, GXProgramCompilationResult& result, bool separable = false) {
+    std::filesystem::path path = key.path();
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    _program_cache_header_t header = {};
+    std::vector<char> binary;
+    if (file.read(reinterpret_cast<char*>(&header), sizeof(header)) && header.magic == _PROGRAM_CACHE_MAGIC &&
+        header.version == _PROGRAM_CACHE_VERSION && header.check == key.check && header.length == key.length) {
+        binary.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    file.close();
+    if (!binary.empty()) {
+        result.program = glCreateProgram();
+        if (separable) glProgramParameteri(result.program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        glProgramBinary(result.program, header.format, binary.data(), (GLsizei)binary.size());
+        glGetProgramiv(result.program, GL_LINK_STATUS, &result.success);
+        if (result.success) return true;
+        glDeleteProgram(result.program);
+        result.program = 0;
+    }
+    // Truncated, foreign, colliding or refused by the driver, it will be replaced after compiling
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    std::lock_guard<std::mutex> lock(m_program_cache.mutex);
+    m_program_cache.stats.rejected++;
+    return false;
+}
+
+static void _program_cache_store(const _program_cache_key_t& key, uint32_t program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+    if (length <= 0) return;
+
+    // Written next to the final path and renamed so a concurrent reader never sees a partial binary, the temporary
+    // name is unique to this writer since threads and other processes may store the same program at the same time
+    std::filesystem::path path = key.path();
+    std::filesystem::path temp = path;
+    char suffix[48];
+    uint64_t writer = std::hash<std::thread::id>()(std::this_thread::get_id()) ^ (uint64_t(std::random_device()()) << 32);
+    snprintf(suffix, sizeof(suffix), ".%016llx.tmp", static_cast<unsigned long long>(writer));
+    temp += suffix;
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        if (!file) return;
+        _program_cache_header_t header = { _PROGRAM_CACHE_MAGIC, _PROGRAM_CACHE_VERSION, key.check, key.length, format, 0 };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), length);
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(temp, ec);
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_program_cache.mutex);
+    m_program_cache.stats.stores++;
+}
+
+// Returns true if binaries can be cached for the current context, `directory` then receives the cache directory
+static bool _program_cache_available(std::filesystem::path& directory) {
+    {
+        std::lock_guard<std::mutex> lock(m_program_cache.mutex);
+        if (!m_program_cache.enabled) return false;
+        directory = m_program_cache.directory;
+    }
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+// Returns true if binaries can be cached for the current context, `key` then receives the cache entry of the stages
+static bool _program_cache_lookup(const _program_stage_t* stages, size_t count, _program_cache_key_t& key, bool separable = false) {
+    std::filesystem::path directory;
+    if (!_program_cache_available(directory)) return false;
+    key = _program_cache_key(stages, count, separable);
+    key.directory = std::move(directory);
+    return true;
+}
+
+static void _program_cache_record(bool hit, std::chrono::steady_clock::time_point start) {
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::lock_guard<std::mutex> lock(m_program_cache.mutex);
+    if (hit) {
+        m_program_cache.stats.hits++;
+        m_program_cache.stats.hit_ms += ms;
+    }
+    else {
+        m_program_cache.stats.misses++;
+        m_program_cache.stats.miss_ms += ms;
+    }
+}
+
+static GXProgramCompilationResult _compile_program(const _program_stage_t* stages, size_t count, bool separable = false) {
     GXProgramCompilationResult result = {};
-    result.vertex_result = gxCompileGLSLShader(vertex_shader_src, GX_GLSL_VERTEX_SHADER);
-    result.fragment_result = gxCompileGLSLShader(fragment_shader_src, GX_GLSL_FRAGMENT_SHADER);
-    if (!result.vertex_result.success || !result.fragment_result.success) return result;
-    result.program = glCreateProgram();
-    glAttachShader(result.program, result.vertex_result.handle);
-    glAttachShader(result.program, result.fragment_result.handle);
-    glLinkProgram(result.program);
-    glGetProgramiv(result.program, GL_LINK_STATUS, &result.success);
-    if (!result.success) glGetProgramInfoLog(result.program, sizeof(result.program_log), NULL, result.program_log);
-    glDeleteShader(result.vertex_result.handle);
-    glDeleteShader(result.fragment_result.handle);
+    for (size_t i = 0; i < count; i++) *stages[i].result = {};
+
+    _program_cache_key_t key;
+    auto start = std::chrono::steady_clock::now();
+    bool cached = _program_cache_lookup(stages, count, key, separable);
+    if (cached && _program_cache_load(key, result, separable)) {
+        for (size_t i = 0; i < count; i++) stages[i].result->success = 1;
+        _program_cache_record(true, start);
+        return result;
+    }
+
+    bool compiled = true;
+    for (size_t i = 0; i < count; i++) {
+        *stages[i].result = gxCompileGLSLShader(stages[i].src, stages[i].type);
+        compiled = compiled && stages[i].result->success;
+    }
+    if (compiled) {
+        result.program = glCreateProgram();
+        if (cached) glProgramParameteri(result.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        if (separable) glProgramParameteri(result.program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        for (size_t i = 0; i < count; i++) glAttachShader(result.program, stages[i].result->handle);
+        glLinkProgram(result.program);
+        glGetProgramiv(result.program, GL_LINK_STATUS, &result.success);
+        if (!result.success) glGetProgramInfoLog(result.program, sizeof(result.program_log), NULL, result.program_log);
+        for (size_t i = 0; i < count; i++) glDetachShader(result.program, stages[i].result->handle);
+    }
+    for (size_t i = 0; i < count; i++) glDeleteShader(stages[i].result->handle);
+
+    if (cached) {
+        if (result.success) _program_cache_store(key, result.program);
+        _program_cache_record(false, start);
+    }
     return result;
 }
 
+GXProgramCompilationResult gxCompileGLSLProgram(const char* vertex_shader_src, const char* fragment_shader_src) {
+    GXProgramCompilationResult result = {};
+    _program_stage_t stages[] = {
+        { vertex_shader_src, GX_GLSL_VERTEX_SHADER, &result.vertex_result },
+        { fragment_shader_src, GX_GLSL_FRAGMENT_SHADER, &result.fragment_result },
+    };
+    GXProgramCompilationResult program = _compile_program(stages, 2);
+    program.vertex_result = result.vertex_result;
+    program.fragment_result = result.fragment_result;
+    return program;
+}
+
 uint32_t gxGenVertexArrayObject() {
     uint32_t vaoId;
     glGenVertexArrays(1, &vaoId); 
@@ -419,16 +982,19 @@ void gxSetVertexAttribute(GXObject* object, uint32_t index, int size, GXVertexAt
     if (!object) return;
     gxBindBufferObject(GX_BUFFER_TYPE_ARRAY, object->vbo);
     glVertexAttribPointer(index, size, type, normalize, stride, pointer);
+    _hitch_forget_layout(nullptr); // Applies to the bound vertex array, which is not necessarily the object's
 }
 
 void gxEnableVertexAttribute(GXObject* object, uint32_t index) { 
     if (!object) return;
     glEnableVertexArrayAttrib(object->vao, index); 
+    _hitch_forget_layout(object);
 }
 
 void gxDisableVertexAttribute(GXObject* object, uint32_t index) { 
     if (!object) return;
     glDisableVertexArrayAttrib(object->vao, index); 
+    _hitch_forget_layout(object);
 }
 
 void gxBindBufferBase(GXBufferType type, uint32_t binding_point, uint32_t bo) {
@@ -442,3 +1008,4957 @@ void gxBindUniformBlock(uint32_t binding_point, uint32_t ubo) {
 void gxUseShader(GXObject* object) {
     glUseProgram(object->shader_program);
 }
+
+GXProgramCompilationResult gxCompileGLSLComputeProgram(const char* compute_shader_src) {
+    GXShaderCompilationResult compute_result = {};
+    _program_stage_t stage = { compute_shader_src, GX_GLSL_COMPUTE_SHADER, &compute_result };
+    GXProgramCompilationResult result = _compile_program(&stage, 1);
+    result.compute_result = compute_result;
+    return result;
+}
+
+void gxExtractFrustumPlanes(const float* m, float* planes) {
+    // Gribb/Hartmann: every plane is the 4th row of the matrix plus or minus one of the other rows
+    for (int i = 0; i < 6; i++) {
+        int row = i / 2;
+        float sign = (i % 2) ? -1.0f : 1.0f;
+        float* p = planes + i * 4;
+        for (int col = 0; col < 4; col++) p[col] = m[col * 4 + 3] + sign * m[col * 4 + row];
+        float length = sqrtf(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        if (length > 0.0f) for (int j = 0; j < 4; j++) p[j] /= length;
+    }
+}
+
+// One invocation per instance, visible instances are compacted per workgroup in shared memory
+// so only a single atomic per workgroup touches the indirect command.
+static const char* _culling_compute_src = R"glsl(
+#version 460 core
+layout(local_size_x = 256) in;
+
+struct Bounds { vec4 center; vec4 extents; };
+layout(std430, binding = 0) readonly buffer BoundsBuffer { Bounds bounds[]; };
+layout(std430, binding = 1) writeonly buffer VisibleBuffer { uint visible_instances[]; };
+layout(std430, binding = 2) buffer CommandBuffer { uint command[]; };
+
+layout(location = 0) uniform vec4 planes[6];
+layout(location = 6) uniform uint instance_count;
+layout(location = 7) uniform uint bounds_type;
+
+shared uint group_count;
+shared uint group_base;
+
+bool isVisible(uint index) {
+	Bounds b = bounds[index];
+	for (int i = 0; i < 6; i++) {
+		float radius = bounds_type == 0u ? b.center.w : dot(abs(planes[i].xyz), b.extents.xyz);
+		if (dot(planes[i].xyz, b.center.xyz) + planes[i].w < -radius) return false;
+	}
+	return true;
+}
+
+void main() {
+	if (gl_LocalInvocationIndex == 0u) group_count = 0u;
+	barrier();
+
+	uint index = gl_GlobalInvocationID.x;
+	bool visible = index < instance_count && isVisible(index);
+	uint local_slot = 0u;
+	if (visible) local_slot = atomicAdd(group_count, 1u);
+	barrier();
+
+	if (gl_LocalInvocationIndex == 0u && group_count > 0u) group_base = atomicAdd(command[1], group_count);
+	barrier();
+
+	if (visible) visible_instances[group_base + local_slot] = index;
+}
+)glsl";
+
+static const uint32_t _culling_group_size = 256;
+
+GXCullingStage* gxAsCullingStage(GXResource* res) { return static_cast<GXCullingStage*>(res->resource); }
+
+GXCullingStage* gxCreateCullingStage(GXObject* object, GXBoundsType bounds_type, uint32_t capacity, uint32_t count, GXVertexAttributeType element_type, uint32_t visible_binding) {
+    if (!m_app || !object || !capacity) return nullptr;
+
+    GXProgramCompilationResult program = gxCompileGLSLComputeProgram(_culling_compute_src);
+    if (!program.success) {
+        if (program.program) glDeleteProgram(program.program);
+        return nullptr;
+    }
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_CULLING_STAGE;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXCullingStage* stage = new GXCullingStage{};
+    resource->resource = stage;
+
+    stage->resource = resource;
+    stage->object = object;
+    stage->bounds_type = bounds_type;
+    stage->primitive = GX_PRIMITIVE_TRIANGLES;
+    stage->capacity = capacity;
+    stage->count = count;
+    stage->element_type = element_type;
+    stage->visible_binding = visible_binding;
+    stage->cull_program = program.program;
+    stage->bounds_buffer = gxGenBufferObject(GX_BUFFER_TYPE_SHADER_STORAGE, GX_BUFFER_USAGE_TYPE_DYNAMIC, sizeof(GXInstanceBounds) * capacity, nullptr);
+    stage->visible_buffer = gxGenBufferObject(GX_BUFFER_TYPE_SHADER_STORAGE, GX_BUFFER_USAGE_TYPE_DYNAMIC, sizeof(uint32_t) * capacity, nullptr);
+    // DrawElementsIndirectCommand is { count, instanceCount, firstIndex, baseVertex, baseInstance },
+    // DrawArraysIndirectCommand shares the leading { count, instanceCount } so one layout serves both.
+    uint32_t command[5] = { count, 0, 0, 0, 0 };
+    stage->command_buffer = gxGenBufferObject(GX_BUFFER_TYPE_DRAW_INDIRECT, GX_BUFFER_USAGE_TYPE_DYNAMIC, sizeof(command), command);
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+
+    return stage;
+}
+
+bool gxUpdateCullingBounds(GXCullingStage* stage, uint32_t first, uint32_t count, const GXInstanceBounds* bounds) {
+    if (!stage || !bounds || count > stage->capacity || first > stage->capacity - count) return false;
+    glNamedBufferSubData(stage->bounds_buffer, sizeof(GXInstanceBounds) * first, sizeof(GXInstanceBounds) * count, bounds);
+    if (first + count > stage->instance_count) stage->instance_count = first + count;
+    return true;
+}
+
+void gxSetCullingInstanceCount(GXCullingStage* stage, uint32_t instance_count) {
+    if (!stage) return;
+    stage->instance_count = instance_count < stage->capacity ? instance_count : stage->capacity;
+}
+
+void gxDispatchCulling(GXCullingStage* stage, const float* view_projection) {
+    if (!stage) return;
+
+    uint32_t zero = 0;
+    glClearNamedBufferSubData(stage->command_buffer, GL_R32UI, sizeof(uint32_t), sizeof(uint32_t), GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    if (!stage->instance_count) return;
+
+    float planes[24];
+    gxExtractFrustumPlanes(view_projection, planes);
+
+    glUseProgram(stage->cull_program);
+    glUniform4fv(0, 6, planes);
+    glUniform1ui(6, stage->instance_count);
+    glUniform1ui(7, stage->bounds_type);
+    gxBindBufferBase(GX_BUFFER_TYPE_SHADER_STORAGE, 0, stage->bounds_buffer);
+    gxBindBufferBase(GX_BUFFER_TYPE_SHADER_STORAGE, 1, stage->visible_buffer);
+    gxBindBufferBase(GX_BUFFER_TYPE_SHADER_STORAGE, 2, stage->command_buffer);
+    glDispatchCompute((stage->instance_count + _culling_group_size - 1) / _culling_group_size, 1, 1);
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+void gxDrawCulled(GXCullingStage* stage) {
+    if (!stage || !stage->object) return;
+    GXObject* object = stage->object;
+    glUseProgram(object->shader_program);
+    gxBindBufferBase(GX_BUFFER_TYPE_SHADER_STORAGE, stage->visible_binding, stage->visible_buffer);
+    gxBindVertexArrayObject(object->vao);
+    gxBindBufferObject(GX_BUFFER_TYPE_DRAW_INDIRECT, stage->command_buffer);
+    if (object->ebo) glDrawElementsIndirect(stage->primitive, stage->element_type, nullptr);
+    else glDrawArraysIndirect(stage->primitive, nullptr);
+    gxBindBufferObject(GX_BUFFER_TYPE_DRAW_INDIRECT, 0);
+}
+
+static size_t _uniform_type_size(GXUniformType type) {
+    switch (type) {
+    case GX_UNIFORM_TYPE_FLOAT: case GX_UNIFORM_TYPE_INT: case GX_UNIFORM_TYPE_UINT: return 4;
+    case GX_UNIFORM_TYPE_VEC2: case GX_UNIFORM_TYPE_IVEC2: case GX_UNIFORM_TYPE_UVEC2: return 8;
+    case GX_UNIFORM_TYPE_VEC3: case GX_UNIFORM_TYPE_IVEC3: case GX_UNIFORM_TYPE_UVEC3: return 12;
+    case GX_UNIFORM_TYPE_VEC4: case GX_UNIFORM_TYPE_IVEC4: case GX_UNIFORM_TYPE_UVEC4: return 16;
+    case GX_UNIFORM_TYPE_MAT3: return 36;
+    case GX_UNIFORM_TYPE_MAT4: return 64;
+    }
+    return 0;
+}
+
+static void _set_program_uniform(uint32_t program, int location, GXUniformType type, int count, const void* data) {
+    const GLfloat* f = static_cast<const GLfloat*>(data);
+    const GLint* i = static_cast<const GLint*>(data);
+    const GLuint* u = static_cast<const GLuint*>(data);
+    switch (type) {
+    case GX_UNIFORM_TYPE_FLOAT: glProgramUniform1fv(program, location, count, f); break;
+    case GX_UNIFORM_TYPE_VEC2: glProgramUniform2fv(program, location, count, f); break;
+    case GX_UNIFORM_TYPE_VEC3: glProgramUniform3fv(program, location, count, f); break;
+    case GX_UNIFORM_TYPE_VEC4: glProgramUniform4fv(program, location, count, f); break;
+    case GX_UNIFORM_TYPE_INT: glProgramUniform1iv(program, location, count, i); break;
+    case GX_UNIFORM_TYPE_IVEC2: glProgramUniform2iv(program, location, count, i); break;
+    case GX_UNIFORM_TYPE_IVEC3: glProgramUniform3iv(program, location, count, i); break;
+    case GX_UNIFORM_TYPE_IVEC4: glProgramUniform4iv(program, location, count, i); break;
+    case GX_UNIFORM_TYPE_UINT: glProgramUniform1uiv(program, location, count, u); break;
+    case GX_UNIFORM_TYPE_UVEC2: glProgramUniform2uiv(program, location, count, u); break;
+    case GX_UNIFORM_TYPE_UVEC3: glProgramUniform3uiv(program, location, count, u); break;
+    case GX_UNIFORM_TYPE_UVEC4: glProgramUniform4uiv(program, location, count, u); break;
+    case GX_UNIFORM_TYPE_MAT3: glProgramUniformMatrix3fv(program, location, count, GL_FALSE, f); break;
+    case GX_UNIFORM_TYPE_MAT4: glProgramUniformMatrix4fv(program, location, count, GL_FALSE, f); break;
+    }
+}
+
+// Commands are stored back to back as { header, command struct, payload } padded to 8 bytes,
+// payloads (uniform and buffer data) are copied so the caller's memory can be reused right away.
+enum _command_type_t : uint32_t {
+    _COMMAND_USE_PROGRAM,
+    _COMMAND_DRAW_ARRAYS,
+    _COMMAND_DRAW_ELEMENTS,
+    _COMMAND_BIND_BUFFER_BASE,
+    _COMMAND_SET_UNIFORM,
+    _COMMAND_UPDATE_BUFFER,
+    _COMMAND_VIEWPORT,
+    _COMMAND_CLEAR_COLOR,
+    _COMMAND_CLEAR,
+    _COMMAND_MULTI_DRAW_ARRAYS,  // Only produced by render bundles
+    _COMMAND_MULTI_DRAW_ELEMENTS // Only produced by render bundles
+};
+
+struct _command_header_t { _command_type_t type; uint32_t size; };
+struct _command_use_program_t { uint32_t program; };
+struct _command_draw_t { GXObject* object; GXPrimitiveType primitive; GXVertexAttributeType element_type; uint64_t offset, count; };
+struct _command_bind_buffer_base_t { GXBufferType type; uint32_t binding_point, bo; };
+struct _command_set_uniform_t { uint32_t program; int location; GXUniformType type; int count; };
+struct _command_update_buffer_t { uint32_t bo; uint64_t offset, length; };
+struct _command_viewport_t { int x, y, w, h; };
+struct _command_clear_color_t { float r, g, b, a; };
+struct _command_clear_t { unsigned int bit; };
+struct _command_multi_draw_t { uint32_t vao; GXPrimitiveType primitive; GXVertexAttributeType element_type; uint32_t draw_count; uint64_t indirect_offset; };
+
+template <typename T>
+static T* _command_push(_command_stream_t* stream, _command_type_t type, size_t payload_size = 0, const void* payload = nullptr) {
+    size_t size = (sizeof(_command_header_t) + sizeof(T) + payload_size + 7) & ~size_t(7);
+    size_t offset = stream->size();
+    stream->resize(offset + size);
+    uint8_t* data = stream->data() + offset;
+    *reinterpret_cast<_command_header_t*>(data) = { type, (uint32_t)size };
+    T* command = reinterpret_cast<T*>(data + sizeof(_command_header_t));
+    if (payload_size) memcpy(command + 1, payload, payload_size);
+    return command;
+}
+
+template <typename T>
+static T* _command_push(GXCommandList* list, _command_type_t type, size_t payload_size = 0, const void* payload = nullptr) {
+    list->command_count++;
+    return _command_push<T>((_command_stream_t*)list->stream_ptr, type, payload_size, payload);
+}
+
+static void _command_copy(_command_stream_t* stream, const _command_header_t* header) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(header);
+    stream->insert(stream->end(), data, data + header->size);
+}
+
+// Replays command streams while skipping program and vertex array binds that are already current
+struct _command_executor_t {
+    uint32_t program = UINT32_MAX;
+    uint32_t vao = UINT32_MAX;
+
+    void bindVertexArray(uint32_t id) {
+        if (id != vao) gxBindVertexArrayObject(vao = id);
+    }
+
+    void execute(const _command_stream_t* stream) {
+        const uint8_t* it = stream->data();
+        const uint8_t* end = it + stream->size();
+        while (it < end) {
+            const _command_header_t* header = reinterpret_cast<const _command_header_t*>(it);
+            const void* command = it + sizeof(_command_header_t);
+            switch (header->type) {
+            case _COMMAND_USE_PROGRAM: {
+                auto c = static_cast<const _command_use_program_t*>(command);
+                if (c->program != program) glUseProgram(program = c->program);
+                break;
+            }
+            case _COMMAND_DRAW_ARRAYS: {
+                auto c = static_cast<const _command_draw_t*>(command);
+                bindVertexArray(c->object->vao);
+                glDrawArrays(c->primitive, c->offset, c->count);
+                break;
+            }
+            case _COMMAND_DRAW_ELEMENTS: {
+                auto c = static_cast<const _command_draw_t*>(command);
+                bindVertexArray(c->object->vao);
+                glDrawElements(c->primitive, c->count, c->element_type, nullptr);
+                break;
+            }
+            case _COMMAND_MULTI_DRAW_ARRAYS: {
+                auto c = static_cast<const _command_multi_draw_t*>(command);
+                bindVertexArray(c->vao);
+                glMultiDrawArraysIndirect(c->primitive, (const void*)(uintptr_t)c->indirect_offset, c->draw_count, 0);
+                break;
+            }
+            case _COMMAND_MULTI_DRAW_ELEMENTS: {
+                auto c = static_cast<const _command_multi_draw_t*>(command);
+                bindVertexArray(c->vao);
+                glMultiDrawElementsIndirect(c->primitive, c->element_type, (const void*)(uintptr_t)c->indirect_offset, c->draw_count, 0);
+                break;
+            }
+            case _COMMAND_BIND_BUFFER_BASE: {
+                auto c = static_cast<const _command_bind_buffer_base_t*>(command);
+                gxBindBufferBase(c->type, c->binding_point, c->bo);
+                break;
+            }
+            case _COMMAND_SET_UNIFORM: {
+                auto c = static_cast<const _command_set_uniform_t*>(command);
+                _set_program_uniform(c->program, c->location, c->type, c->count, c + 1);
+                break;
+            }
+            case _COMMAND_UPDATE_BUFFER: {
+                auto c = static_cast<const _command_update_buffer_t*>(command);
+                glNamedBufferSubData(c->bo, c->offset, c->length, c + 1);
+                break;
+            }
+            case _COMMAND_VIEWPORT: {
+                auto c = static_cast<const _command_viewport_t*>(command);
+                gxViewport(c->x, c->y, c->w, c->h);
+                break;
+            }
+            case _COMMAND_CLEAR_COLOR: {
+                auto c = static_cast<const _command_clear_color_t*>(command);
+                gxClearColor(c->r, c->g, c->b, c->a);
+                break;
+            }
+            case _COMMAND_CLEAR:
+                gxClear(static_cast<const _command_clear_t*>(command)->bit);
+                break;
+            }
+            it += header->size;
+        }
+    }
+};
+
+GXCommandList* gxAsCommandList(GXResource* res) { return static_cast<GXCommandList*>(res->resource); }
+
+GXCommandList* gxCreateCommandList() {
+    if (!m_app) return nullptr;
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_COMMAND_LIST;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXCommandList* list = new GXCommandList{ resource, 0, new _command_stream_t() };
+    resource->resource = list;
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+
+    return list;
+}
+
+void gxResetCommandList(GXCommandList* list) {
+    if (!list) return;
+    ((_command_stream_t*)list->stream_ptr)->clear();
+    list->command_count = 0;
+}
+
+void gxCmdUseShader(GXCommandList* list, GXObject* object) {
+    if (!list || !object) return;
+    gxCmdUseProgram(list, object->shader_program);
+}
+
+void gxCmdUseProgram(GXCommandList* list, uint32_t program) {
+    if (!list) return;
+    _command_push<_command_use_program_t>(list, _COMMAND_USE_PROGRAM)->program = program;
+}
+
+void gxCmdDrawPrimitives(GXCommandList* list, GXObject* object, GXPrimitiveType primitive, size_t offset, size_t count) {
+    if (!list || !object) return;
+    *_command_push<_command_draw_t>(list, _COMMAND_DRAW_ARRAYS) = { object, primitive, GX_VERTEX_ATTRIB_TYPE_UNSIGNED_INT, offset, count };
+}
+
+void gxCmdDrawPrimitiveElements(GXCommandList* list, GXObject* object, GXPrimitiveType primitive, size_t count, GXVertexAttributeType type) {
+    if (!list || !object) return;
+    *_command_push<_command_draw_t>(list, _COMMAND_DRAW_ELEMENTS) = { object, primitive, type, 0, count };
+}
+
+void gxCmdBindBufferBase(GXCommandList* list, GXBufferType type, uint32_t binding_point, uint32_t bo) {
+    if (!list) return;
+    *_command_push<_command_bind_buffer_base_t>(list, _COMMAND_BIND_BUFFER_BASE) = { type, binding_point, bo };
+}
+
+void gxCmdSetUniform(GXCommandList* list, uint32_t program, int location, GXUniformType type, int count, const void* data) {
+    if (!list || !data || count <= 0) return;
+    *_command_push<_command_set_uniform_t>(list, _COMMAND_SET_UNIFORM, _uniform_type_size(type) * count, data) = { program, location, type, count };
+}
+
+void gxCmdUpdateBuffer(GXCommandList* list, uint32_t bo, size_t offset, size_t length, const void* data) {
+    if (!list || !bo || !data) return;
+    *_command_push<_command_update_buffer_t>(list, _COMMAND_UPDATE_BUFFER, length, data) = { bo, offset, length };
+}
+
+void gxCmdViewport(GXCommandList* list, int x, int y, int w, int h) {
+    if (!list) return;
+    *_command_push<_command_viewport_t>(list, _COMMAND_VIEWPORT) = { x, y, w, h };
+}
+
+void gxCmdClearColor(GXCommandList* list, float r, float g, float b, float a) {
+    if (!list) return;
+    *_command_push<_command_clear_color_t>(list, _COMMAND_CLEAR_COLOR) = { r, g, b, a };
+}
+
+void gxCmdClear(GXCommandList* list, unsigned int bit) {
+    if (!list) return;
+    _command_push<_command_clear_t>(list, _COMMAND_CLEAR)->bit = bit;
+}
+
+void gxExecuteCommandLists(GXCommandList** lists, size_t count) {
+    if (!lists) return;
+    _command_executor_t executor;
+    for (size_t l = 0; l < count; l++) {
+        if (lists[l]) executor.execute((_command_stream_t*)lists[l]->stream_ptr);
+    }
+}
+
+GXRenderBundle* gxAsRenderBundle(GXResource* res) { return static_cast<GXRenderBundle*>(res->resource); }
+
+// Draws between two state changes that are not program changes, sortable and mergeable
+struct _bundle_draw_t {
+    uint32_t program;
+    const _command_header_t* header;
+    const _command_draw_t* draw;
+
+    bool mergeable(const _bundle_draw_t& other) const {
+        return program == other.program && header->type == other.header->type && draw->object->vao == other.draw->object->vao &&
+            draw->primitive == other.draw->primitive && (header->type == _COMMAND_DRAW_ARRAYS || draw->element_type == other.draw->element_type);
+    }
+    bool operator<(const _bundle_draw_t& other) const {
+        // Draws without a recorded program must replay before the first program switch, so UINT32_MAX wraps to sort first
+        if (program != other.program) return uint32_t(program + 1) < uint32_t(other.program + 1);
+        if (draw->object->vao != other.draw->object->vao) return draw->object->vao < other.draw->object->vao;
+        if (header->type != other.header->type) return header->type < other.header->type;
+        if (draw->element_type != other.draw->element_type) return draw->element_type < other.draw->element_type;
+        return draw->primitive < other.draw->primitive;
+    }
+};
+
+GXRenderBundle* gxCreateRenderBundle(GXCommandList* list, GXBundleOptions options) {
+    if (!m_app || !list) return nullptr;
+
+    const _command_stream_t* source = (_command_stream_t*)list->stream_ptr;
+    _command_stream_t* stream = new _command_stream_t();
+    std::unordered_set<GXResource*>* objects = new std::unordered_set<GXResource*>();
+    std::vector<uint32_t> indirect;
+    uint32_t command_count = 0, draw_count = 0;
+
+    // State as it will be during replay, used to drop commands that would not change anything
+    uint32_t emitted_program = UINT32_MAX, recorded_program = UINT32_MAX;
+    std::unordered_map<uint64_t, uint32_t> bindings;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> uniforms;
+    _command_viewport_t viewport = {};
+    _command_clear_color_t clear_color = {};
+    bool has_viewport = false, has_clear_color = false;
+
+    std::vector<_bundle_draw_t> segment;
+    auto flush_segment = [&]() {
+        if (options & GX_BUNDLE_OPTION_SORT) std::stable_sort(segment.begin(), segment.end());
+        for (size_t i = 0; i < segment.size();) {
+            size_t j = i + 1;
+            while (j < segment.size() && segment[i].mergeable(segment[j])) j++;
+
+            // Draws recorded before any program change keep using whatever program is active at replay
+            if (segment[i].program != emitted_program && segment[i].program != UINT32_MAX) {
+                _command_push<_command_use_program_t>(stream, _COMMAND_USE_PROGRAM)->program = emitted_program = segment[i].program;
+                command_count++;
+            }
+            if (j - i == 1) {
+                _command_copy(stream, segment[i].header);
+            }
+            else {
+                bool elements = segment[i].header->type == _COMMAND_DRAW_ELEMENTS;
+                uint64_t indirect_offset = indirect.size() * sizeof(uint32_t);
+                for (size_t k = i; k < j; k++) {
+                    // { count, instanceCount, first, baseInstance } or { count, instanceCount, firstIndex, baseVertex, baseInstance }
+                    const _command_draw_t* draw = segment[k].draw;
+                    if (elements) indirect.insert(indirect.end(), { (uint32_t)draw->count, 1, (uint32_t)draw->offset, 0, 0 });
+                    else indirect.insert(indirect.end(), { (uint32_t)draw->count, 1, (uint32_t)draw->offset, 0 });
+                }
+                *_command_push<_command_multi_draw_t>(stream, elements ? _COMMAND_MULTI_DRAW_ELEMENTS : _COMMAND_MULTI_DRAW_ARRAYS) = {
+                    segment[i].draw->object->vao, segment[i].draw->primitive, segment[i].draw->element_type, (uint32_t)(j - i), indirect_offset
+                };
+            }
+            command_count++;
+            draw_count++;
+            i = j;
+        }
+        segment.clear();
+    };
+
+    const uint8_t* it = source->data();
+    const uint8_t* end = it + source->size();
+    for (; it < end; it += reinterpret_cast<const _command_header_t*>(it)->size) {
+        const _command_header_t* header = reinterpret_cast<const _command_header_t*>(it);
+        const void* command = it + sizeof(_command_header_t);
+
+        if (header->type == _COMMAND_USE_PROGRAM) {
+            recorded_program = static_cast<const _command_use_program_t*>(command)->program;
+            continue;
+        }
+        if (header->type == _COMMAND_DRAW_ARRAYS || header->type == _COMMAND_DRAW_ELEMENTS) {
+            auto draw = static_cast<const _command_draw_t*>(command);
+            objects->insert(draw->object->resource);
+            segment.push_back({ recorded_program, header, draw });
+            continue;
+        }
+
+        bool redundant = false;
+        switch (header->type) {
+        case _COMMAND_BIND_BUFFER_BASE: {
+            auto c = static_cast<const _command_bind_buffer_base_t*>(command);
+            uint64_t key = (uint64_t(c->type) << 32) | c->binding_point;
+            auto binding = bindings.find(key);
+            redundant = binding != bindings.end() && binding->second == c->bo;
+            bindings[key] = c->bo;
+            break;
+        }
+        case _COMMAND_SET_UNIFORM: {
+            auto c = static_cast<const _command_set_uniform_t*>(command);
+            uint64_t key = (uint64_t(c->program) << 32) | uint32_t(c->location);
+            const uint8_t* value = reinterpret_cast<const uint8_t*>(c);
+            std::vector<uint8_t> bytes(value, value + sizeof(*c) + _uniform_type_size(c->type) * c->count);
+            auto uniform = uniforms.find(key);
+            redundant = uniform != uniforms.end() && uniform->second == bytes;
+            uniforms[key] = std::move(bytes);
+            break;
+        }
+        case _COMMAND_VIEWPORT: {
+            auto c = static_cast<const _command_viewport_t*>(command);
+            redundant = has_viewport && !memcmp(&viewport, c, sizeof(viewport));
+            viewport = *c;
+            has_viewport = true;
+            break;
+        }
+        case _COMMAND_CLEAR_COLOR: {
+            auto c = static_cast<const _command_clear_color_t*>(command);
+            redundant = has_clear_color && !memcmp(&clear_color, c, sizeof(clear_color));
+            clear_color = *c;
+            has_clear_color = true;
+            break;
+        }
+        default:
+            break;
+        }
+        if (redundant) continue;
+
+        // Any other state change ends the sortable segment
+        flush_segment();
+        _command_copy(stream, header);
+        command_count++;
+    }
+    flush_segment();
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_RENDER_BUNDLE;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXRenderBundle* bundle = new GXRenderBundle{ resource, true, options, command_count, draw_count, 0, stream, objects };
+    resource->resource = bundle;
+    if (!indirect.empty()) {
+        bundle->indirect_buffer = gxGenBufferObject(GX_BUFFER_TYPE_DRAW_INDIRECT, GX_BUFFER_USAGE_TYPE_STATIC, indirect.size() * sizeof(uint32_t), indirect.data());
+    }
+    for (GXResource* object : *objects) m_bundle_references[object].insert(bundle);
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+
+    return bundle;
+}
+
+bool gxExecuteBundle(GXRenderBundle* bundle) {
+    if (!bundle || !bundle->valid) return false;
+    if (bundle->indirect_buffer) gxBindBufferObject(GX_BUFFER_TYPE_DRAW_INDIRECT, bundle->indirect_buffer);
+    _command_executor_t executor;
+    executor.execute((_command_stream_t*)bundle->stream_ptr);
+    if (bundle->indirect_buffer) gxBindBufferObject(GX_BUFFER_TYPE_DRAW_INDIRECT, 0);
+    return true;
+}
+
+void gxOrthographicProjection(float* out, float left, float right, float bottom, float top, float near_plane, float far_plane) {
+    memset(out, 0, sizeof(float) * 16);
+    out[0] = 2.0f / (right - left);
+    out[5] = 2.0f / (top - bottom);
+    out[10] = -2.0f / (far_plane - near_plane);
+    out[12] = -(right + left) / (right - left);
+    out[13] = -(top + bottom) / (top - bottom);
+    out[14] = -(far_plane + near_plane) / (far_plane - near_plane);
+    out[15] = 1.0f;
+}
+
+static const char* _sprite_vertex_src = R"glsl(
+#version 460 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in vec2 aUV;
+layout(location = 2) in vec4 aColor;
+
+layout(location = 0) uniform mat4 projection;
+
+layout(location = 0) out vec2 vUV;
+layout(location = 1) out vec4 vColor;
+
+void main() {
+	gl_Position = projection * vec4(aPos, 0.0, 1.0);
+	vUV = aUV;
+	vColor = aColor;
+}
+)glsl";
+
+static const char* _sprite_fragment_src = R"glsl(
+#version 460 core
+layout(location = 0) in vec2 vUV;
+layout(location = 1) in vec4 vColor;
+
+layout(binding = 0) uniform sampler2D sprite_texture;
+
+out vec4 fragColor;
+
+void main() {
+	fragColor = texture(sprite_texture, vUV) * vColor;
+}
+)glsl";
+
+struct _sprite_vertex_t {
+    float x, y, u, v;
+    uint32_t color;
+};
+
+GXSpriteBatch* gxAsSpriteBatch(GXResource* res) { return static_cast<GXSpriteBatch*>(res->resource); }
+
+GXSpriteBatch* gxCreateSpriteBatch(uint32_t capacity, GXSpriteSortMode sort_mode) {
+    if (!m_app || !capacity) return nullptr;
+
+    GXProgramCompilationResult program = gxCompileGLSLProgram(_sprite_vertex_src, _sprite_fragment_src);
+    if (!program.success) {
+        if (program.program) glDeleteProgram(program.program);
+        return nullptr;
+    }
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_SPRITE_BATCH;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXSpriteBatch* batch = new GXSpriteBatch{};
+    resource->resource = batch;
+
+    batch->resource = resource;
+    batch->capacity = capacity;
+    batch->sort_mode = sort_mode;
+    batch->default_program = program.program;
+    gxOrthographicProjection(batch->projection, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+    batch->sprites_ptr = new _sprite_queue_t();
+    ((_sprite_queue_t*)batch->sprites_ptr)->reserve(capacity);
+
+    uint32_t white = 0xFFFFFFFF;
+    glCreateTextures(GL_TEXTURE_2D, 1, &batch->white_texture);
+    glTextureStorage2D(batch->white_texture, 1, GL_RGBA8, 1, 1);
+    glTextureSubImage2D(batch->white_texture, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+
+    // The quad pattern never changes, so a single element buffer serves every flush
+    std::vector<uint32_t> indices(size_t(capacity) * 6);
+    for (uint32_t i = 0; i < capacity; i++) {
+        uint32_t v = i * 4;
+        uint32_t* quad = indices.data() + size_t(i) * 6;
+        quad[0] = v; quad[1] = v + 1; quad[2] = v + 2;
+        quad[3] = v + 2; quad[4] = v + 3; quad[5] = v;
+    }
+    batch->vbo = gxGenBufferObject(GX_BUFFER_TYPE_ARRAY, GX_BUFFER_USAGE_TYPE_STREAM, sizeof(_sprite_vertex_t) * 4 * size_t(capacity), nullptr);
+    batch->ebo = gxGenBufferObject(GX_BUFFER_TYPE_ELEMENT_ARRAY, GX_BUFFER_USAGE_TYPE_STATIC, indices.size() * sizeof(uint32_t), indices.data());
+
+    glCreateVertexArrays(1, &batch->vao);
+    glVertexArrayVertexBuffer(batch->vao, 0, batch->vbo, 0, sizeof(_sprite_vertex_t));
+    glVertexArrayElementBuffer(batch->vao, batch->ebo);
+    glVertexArrayAttribFormat(batch->vao, 0, 2, GL_FLOAT, GL_FALSE, offsetof(_sprite_vertex_t, x));
+    glVertexArrayAttribFormat(batch->vao, 1, 2, GL_FLOAT, GL_FALSE, offsetof(_sprite_vertex_t, u));
+    glVertexArrayAttribFormat(batch->vao, 2, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(_sprite_vertex_t, color));
+    for (uint32_t attribute = 0; attribute < 3; attribute++) {
+        glVertexArrayAttribBinding(batch->vao, attribute, 0);
+        glEnableVertexArrayAttrib(batch->vao, attribute);
+    }
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+
+    return batch;
+}
+
+void gxSpriteBatchBegin(GXSpriteBatch* batch, const float* projection) {
+    if (!batch) return;
+    if (projection) memcpy(batch->projection, projection, sizeof(batch->projection));
+    else gxOrthographicProjection(batch->projection, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+    ((_sprite_queue_t*)batch->sprites_ptr)->clear();
+    batch->draw_count = 0;
+}
+
+static void _sprite_batch_flush(GXSpriteBatch* batch) {
+    _sprite_queue_t* sprites = (_sprite_queue_t*)batch->sprites_ptr;
+    if (sprites->empty()) return;
+
+    auto program_of = [batch](const GXSprite& s) { return s.shader_program ? s.shader_program : batch->default_program; };
+    auto texture_of = [batch](const GXSprite& s) { return s.texture ? s.texture : batch->white_texture; };
+    if (batch->sort_mode == GX_SPRITE_SORT_TEXTURE) {
+        std::stable_sort(sprites->begin(), sprites->end(), [&](const GXSprite& a, const GXSprite& b) {
+            if (program_of(a) != program_of(b)) return program_of(a) < program_of(b);
+            return texture_of(a) < texture_of(b);
+        });
+    }
+
+    // Orphan the previous contents so the upload never waits for draws of the last flush
+    size_t size = sizeof(_sprite_vertex_t) * 4 * sprites->size();
+    gxBindBufferObject(GX_BUFFER_TYPE_ARRAY, batch->vbo);
+    _sprite_vertex_t* vertex = (_sprite_vertex_t*)gxMapBufferRange(GX_BUFFER_TYPE_ARRAY, 0, size, GX_MAP_SIMPLE_WRITE);
+    if (!vertex) {
+        gxBindBufferObject(GX_BUFFER_TYPE_ARRAY, 0);
+        sprites->clear();
+        return;
+    }
+    for (const GXSprite& s : *sprites) {
+        float c = cosf(s.rotation), sn = sinf(s.rotation);
+        float x0 = -s.origin_x * s.width, y0 = -s.origin_y * s.height;
+        float x1 = x0 + s.width, y1 = y0 + s.height;
+        const float corners[4][4] = { { x0, y0, s.u0, s.v0 }, { x1, y0, s.u1, s.v0 }, { x1, y1, s.u1, s.v1 }, { x0, y1, s.u0, s.v1 } };
+        for (const auto& corner : corners) {
+            *vertex++ = { s.x + corner[0] * c - corner[1] * sn, s.y + corner[0] * sn + corner[1] * c, corner[2], corner[3], s.color };
+        }
+    }
+    gxUnmapBuffer(GX_BUFFER_TYPE_ARRAY);
+    gxBindBufferObject(GX_BUFFER_TYPE_ARRAY, 0);
+
+    gxBindVertexArrayObject(batch->vao);
+    uint32_t current_program = 0;
+    for (size_t first = 0; first < sprites->size();) {
+        uint32_t program = program_of((*sprites)[first]), texture = texture_of((*sprites)[first]);
+        size_t last = first + 1;
+        while (last < sprites->size() && program_of((*sprites)[last]) == program && texture_of((*sprites)[last]) == texture) last++;
+
+        if (program != current_program) {
+            glUseProgram(current_program = program);
+            glProgramUniformMatrix4fv(program, 0, 1, GL_FALSE, batch->projection);
+        }
+        glBindTextureUnit(0, texture);
+        glDrawElements(GL_TRIANGLES, GLsizei((last - first) * 6), GL_UNSIGNED_INT, (const void*)(first * 6 * sizeof(uint32_t)));
+        batch->draw_count++;
+        first = last;
+    }
+    sprites->clear();
+}
+
+void gxSpriteBatchDraw(GXSpriteBatch* batch, const GXSprite* sprites, size_t count) {
+    if (!batch || !sprites) return;
+    _sprite_queue_t* queue = (_sprite_queue_t*)batch->sprites_ptr;
+    while (count) {
+        size_t room = batch->capacity - queue->size();
+        size_t n = count < room ? count : room;
+        queue->insert(queue->end(), sprites, sprites + n);
+        sprites += n;
+        count -= n;
+        if (queue->size() == batch->capacity) _sprite_batch_flush(batch);
+    }
+}
+
+void gxSpriteBatchEnd(GXSpriteBatch* batch) {
+    if (!batch) return;
+    _sprite_batch_flush(batch);
+}
+
+static const char* _debug_vertex_src = R"glsl(
+#version 460 core
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec4 aColor;
+
+layout(location = 0) uniform mat4 view_projection;
+
+layout(location = 0) out vec4 vColor;
+
+void main() {
+	gl_Position = view_projection * vec4(aPos, 1.0);
+	gl_PointSize = 4.0;
+	vColor = aColor;
+}
+)glsl";
+
+static const char* _debug_fragment_src = R"glsl(
+#version 460 core
+layout(location = 0) in vec4 vColor;
+
+out vec4 fragColor;
+
+void main() {
+	fragColor = vColor;
+}
+)glsl";
+
+struct _debug_vertex_t { float x, y, z; uint32_t color; };
+
+// Primitives with a duration, re-queued by every flush of their window until they expire
+struct _debug_persistent_t {
+    double expires;
+    GXWindow* window;  // nullptr when queued outside a draw callback, the next window flushed adopts it
+    bool line, depth;
+    _debug_vertex_t a, b;
+};
+
+// GL objects are not shared between the contexts of different windows
+struct _debug_context_t { uint32_t program, vao, vbo; size_t capacity; };
+
+struct _debug_draw_state_t {
+    float view_projection[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    std::vector<_debug_vertex_t> lines[2], points[2]; // Indexed by depth testing
+    std::vector<_debug_persistent_t> persistent;
+    std::unordered_map<void*, _debug_context_t> contexts;
+};
+static _debug_draw_state_t m_debug;
+
+static void _debug_forget_window(GXWindow* win) {
+    m_debug.contexts.erase(win->internal);
+    m_debug.persistent.erase(std::remove_if(m_debug.persistent.begin(), m_debug.persistent.end(),
+        [win](const _debug_persistent_t& p) { return p.window == win; }), m_debug.persistent.end());
+}
+
+static void _debug_push(bool line, const float* a, const float* b, uint32_t color, GXDebugDrawFlags flags, float duration) {
+    bool depth = flags & GX_DEBUG_DRAW_DEPTH_TEST;
+    _debug_vertex_t va = { a[0], a[1], a[2], color };
+    _debug_vertex_t vb = line ? _debug_vertex_t{ b[0], b[1], b[2], color } : va;
+    if (duration > 0.0f) {
+        m_debug.persistent.push_back({ glfwGetTime() + duration, m_current_window, line, depth, va, vb });
+    }
+    else if (line) {
+        m_debug.lines[depth].push_back(va);
+        m_debug.lines[depth].push_back(vb);
+    }
+    else {
+        m_debug.points[depth].push_back(va);
+    }
+}
+
+void gxDebugSetViewProjection(const float* view_projection) {
+    if (view_projection) memcpy(m_debug.view_projection, view_projection, sizeof(m_debug.view_projection));
+}
+
+void gxDebugPoint(const float* position, uint32_t color, GXDebugDrawFlags flags, float duration) {
+    if (position) _debug_push(false, position, nullptr, color, flags, duration);
+}
+
+void gxDebugLine(const float* from, const float* to, uint32_t color, GXDebugDrawFlags flags, float duration) {
+    if (from && to) _debug_push(true, from, to, color, flags, duration);
+}
+
+void gxDebugBox(const float* center, const float* half_extents, uint32_t color, GXDebugDrawFlags flags, float duration) {
+    if (!center || !half_extents) return;
+    float corners[8][3];
+    for (int i = 0; i < 8; i++) {
+        for (int axis = 0; axis < 3; axis++) corners[i][axis] = center[axis] + ((i >> axis) & 1 ? half_extents[axis] : -half_extents[axis]);
+    }
+    // Every edge connects 2 corners that differ in exactly one axis bit
+    for (int i = 0; i < 8; i++) {
+        for (int axis = 0; axis < 3; axis++) {
+            if (!((i >> axis) & 1)) _debug_push(true, corners[i], corners[i | (1 << axis)], color, flags, duration);
+        }
+    }
+}
+
+void gxDebugSphere(const float* center, float radius, uint32_t color, GXDebugDrawFlags flags, float duration) {
+    if (!center) return;
+    const int segments = 24;
+    const float step = 6.28318530718f / segments;
+    for (int axis = 0; axis < 3; axis++) {
+        int u = (axis + 1) % 3, v = (axis + 2) % 3;
+        float previous[3] = { center[0], center[1], center[2] };
+        previous[u] += radius;
+        for (int i = 1; i <= segments; i++) {
+            float point[3] = { center[0], center[1], center[2] };
+            point[u] += cosf(i * step) * radius;
+            point[v] += sinf(i * step) * radius;
+            _debug_push(true, previous, point, color, flags, duration);
+            memcpy(previous, point, sizeof(point));
+        }
+    }
+}
+
+void gxDebugArrow(const float* from, const float* to, uint32_t color, GXDebugDrawFlags flags, float duration) {
+    if (!from || !to) return;
+    _debug_push(true, from, to, color, flags, duration);
+
+    float d[3] = { to[0] - from[0], to[1] - from[1], to[2] - from[2] };
+    float length = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    if (length <= 0.0f) return;
+    for (float& c : d) c /= length;
+
+    // Two vectors perpendicular to the arrow span the head
+    float up[3] = { 0.0f, 1.0f, 0.0f };
+    if (fabsf(d[1]) > 0.99f) up[0] = 1.0f, up[1] = 0.0f;
+    float u[3] = { d[1] * up[2] - d[2] * up[1], d[2] * up[0] - d[0] * up[2], d[0] * up[1] - d[1] * up[0] };
+    float u_length = sqrtf(u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+    for (float& c : u) c /= u_length;
+    float v[3] = { d[1] * u[2] - d[2] * u[1], d[2] * u[0] - d[0] * u[2], d[0] * u[1] - d[1] * u[0] };
+
+    float head = length * 0.2f;
+    for (int i = 0; i < 4; i++) {
+        const float* side = i < 2 ? u : v;
+        float sign = (i % 2) ? -0.5f : 0.5f;
+        float point[3];
+        for (int axis = 0; axis < 3; axis++) point[axis] = to[axis] - d[axis] * head + side[axis] * head * sign;
+        _debug_push(true, to, point, color, flags, duration);
+    }
+}
+
+void gxDebugFlush() {
+    double now = glfwGetTime();
+    size_t kept = 0;
+    for (_debug_persistent_t& p : m_debug.persistent) {
+        if (p.expires < now) continue;
+        if (!p.window) p.window = m_current_window;
+        if (p.window == m_current_window) {
+            if (p.line) {
+                m_debug.lines[p.depth].push_back(p.a);
+                m_debug.lines[p.depth].push_back(p.b);
+            }
+            else m_debug.points[p.depth].push_back(p.a);
+        }
+        m_debug.persistent[kept++] = p;
+    }
+    m_debug.persistent.resize(kept);
+
+    std::vector<_debug_vertex_t>* lists[4] = { &m_debug.lines[1], &m_debug.points[1], &m_debug.lines[0], &m_debug.points[0] };
+    size_t total = 0;
+    for (auto list : lists) total += list->size();
+    void* context = glfwGetCurrentContext();
+    if (!total || !context) {
+        for (auto list : lists) list->clear();
+        return;
+    }
+
+    auto found = m_debug.contexts.find(context);
+    if (found == m_debug.contexts.end()) {
+        GXProgramCompilationResult program = gxCompileGLSLProgram(_debug_vertex_src, _debug_fragment_src);
+        if (!program.success) {
+            for (auto list : lists) list->clear();
+            return;
+        }
+        _debug_context_t created = { program.program, 0, 0, 0 };
+        glCreateBuffers(1, &created.vbo);
+        glCreateVertexArrays(1, &created.vao);
+        glVertexArrayVertexBuffer(created.vao, 0, created.vbo, 0, sizeof(_debug_vertex_t));
+        glVertexArrayAttribFormat(created.vao, 0, 3, GL_FLOAT, GL_FALSE, offsetof(_debug_vertex_t, x));
+        glVertexArrayAttribFormat(created.vao, 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(_debug_vertex_t, color));
+        for (uint32_t attribute = 0; attribute < 2; attribute++) {
+            glVertexArrayAttribBinding(created.vao, attribute, 0);
+            glEnableVertexArrayAttrib(created.vao, attribute);
+        }
+        found = m_debug.contexts.emplace(context, created).first;
+    }
+    _debug_context_t& ctx = found->second;
+
+    // Grow geometrically, otherwise orphan the previous storage so the upload never waits on the GPU
+    if (total > ctx.capacity) ctx.capacity = total + total / 2;
+    glNamedBufferData(ctx.vbo, ctx.capacity * sizeof(_debug_vertex_t), nullptr, GL_STREAM_DRAW);
+    _debug_vertex_t* dest = (_debug_vertex_t*)glMapNamedBufferRange(ctx.vbo, 0, total * sizeof(_debug_vertex_t), GX_MAP_SIMPLE_WRITE);
+    if (!dest) {
+        for (auto list : lists) list->clear();
+        return;
+    }
+    for (auto list : lists) {
+        memcpy(dest, list->data(), list->size() * sizeof(_debug_vertex_t));
+        dest += list->size();
+    }
+    glUnmapNamedBuffer(ctx.vbo);
+
+    GLint previous_program = 0, previous_vao = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &previous_program);
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previous_vao);
+    GLboolean previous_depth = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean previous_point_size = glIsEnabled(GL_PROGRAM_POINT_SIZE);
+
+    glUseProgram(ctx.program);
+    glProgramUniformMatrix4fv(ctx.program, 0, 1, GL_FALSE, m_debug.view_projection);
+    gxBindVertexArrayObject(ctx.vao);
+    glEnable(GL_PROGRAM_POINT_SIZE);
+    GLint first = 0;
+    for (int i = 0; i < 4; i++) {
+        GLsizei count = (GLsizei)lists[i]->size();
+        if (!count) continue;
+        if (i < 2) glEnable(GL_DEPTH_TEST);
+        else glDisable(GL_DEPTH_TEST);
+        glDrawArrays(i % 2 ? GL_POINTS : GL_LINES, first, count);
+        first += count;
+        lists[i]->clear();
+    }
+
+    if (previous_depth) glEnable(GL_DEPTH_TEST);
+    else glDisable(GL_DEPTH_TEST);
+    if (!previous_point_size) glDisable(GL_PROGRAM_POINT_SIZE);
+    gxBindVertexArrayObject(previous_vao);
+    glUseProgram(previous_program);
+}
+
+void gxDebugClear() {
+    for (int depth = 0; depth < 2; depth++) {
+        m_debug.lines[depth].clear();
+        m_debug.points[depth].clear();
+    }
+    m_debug.persistent.clear();
+}
+
+bool gxEnableProgramCache(const char* directory) {
+    std::error_code ec;
+    if (directory) std::filesystem::create_directories(directory, ec);
+    bool enabled = directory && std::filesystem::is_directory(directory, ec);
+    // Compiles already in flight keep the directory they copied
+    std::lock_guard<std::mutex> lock(m_program_cache.mutex);
+    m_program_cache.enabled = enabled;
+    m_program_cache.directory = enabled ? directory : "";
+    if (enabled) m_program_cache.stats = {};
+    return enabled;
+}
+
+GXProgramCacheStats gxGetProgramCacheStats() {
+    std::lock_guard<std::mutex> lock(m_program_cache.mutex);
+    return m_program_cache.stats;
+}
+
+void gxResetProgramCacheStats() {
+    std::lock_guard<std::mutex> lock(m_program_cache.mutex);
+    m_program_cache.stats = {};
+}
+
+// Hidden contexts sharing objects with one window's context, each owned by a worker thread.
+// Jobs are called with `true` on a worker, or with `false` when the pool shuts down before running them.
+struct _shader_worker_pool_t {
+    std::vector<GLFWwindow*> contexts;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void(bool)>> jobs;
+    bool stop = false;
+};
+static std::unordered_map<void*, _shader_worker_pool_t*> m_shader_workers; // Keyed by the shared window context
+
+static void _shader_worker_main(_shader_worker_pool_t* pool, GLFWwindow* context) {
+    glfwMakeContextCurrent(context);
+    for (;;) {
+        std::function<void(bool)> job;
+        {
+            std::unique_lock<std::mutex> lock(pool->mutex);
+            pool->cv.wait(lock, [pool] { return pool->stop || !pool->jobs.empty(); });
+            if (pool->stop) break;
+            job = std::move(pool->jobs.front());
+            pool->jobs.pop_front();
+        }
+        job(true);
+    }
+    glfwMakeContextCurrent(nullptr);
+}
+
+// Must be called on the main thread, GLFW only creates windows there
+static _shader_worker_pool_t* _shader_workers() {
+    GLFWwindow* share = glfwGetCurrentContext();
+    if (!share) return nullptr;
+    auto found = m_shader_workers.find(share);
+    if (found != m_shader_workers.end()) return found->second;
+
+    _shader_worker_pool_t* pool = new _shader_worker_pool_t();
+    unsigned count = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    for (unsigned i = 0; i < count; i++) {
+        GLFWwindow* context = _create_glfw_window(1, 1, "", share);
+        if (!context) break;
+        pool->contexts.push_back(context);
+    }
+    glfwMakeContextCurrent(share);
+    if (pool->contexts.empty()) {
+        delete pool;
+        return nullptr;
+    }
+    for (GLFWwindow* context : pool->contexts) pool->threads.emplace_back(_shader_worker_main, pool, context);
+    m_shader_workers[share] = pool;
+    return pool;
+}
+
+static void _shader_workers_submit(_shader_worker_pool_t* pool, std::function<void(bool)> job) {
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->jobs.push_back(std::move(job));
+    }
+    pool->cv.notify_one();
+}
+
+// Shuts down the pool sharing `share`, or every pool if `share` is nullptr
+static void _shader_workers_destroy(void* share) {
+    for (auto it = m_shader_workers.begin(); it != m_shader_workers.end();) {
+        if (share && it->first != share) {
+            it++;
+            continue;
+        }
+        _shader_worker_pool_t* pool = it->second;
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            pool->stop = true;
+        }
+        pool->cv.notify_all();
+        for (std::thread& thread : pool->threads) thread.join();
+        for (GLFWwindow* context : pool->contexts) glfwDestroyWindow(context);
+        for (auto& job : pool->jobs) job(false);
+        delete pool;
+        it = m_shader_workers.erase(it);
+    }
+}
+
+struct _pending_program_t {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false, cancelled = false;
+    GXProgramCompilationResult result = {};
+    std::string vertex_src, fragment_src;
+
+    // Driver side parallel compilation, shaders are kept until the link completes to read their logs
+    bool parallel = false;
+    uint32_t vertex = 0, fragment = 0;
+    bool cached = false;
+    _program_cache_key_t cache_key;
+    std::chrono::steady_clock::time_point start;
+};
+typedef std::shared_ptr<_pending_program_t> _pending_program_ptr_t;
+
+static std::unordered_set<void*> m_parallel_compile_contexts;
+
+static bool _parallel_compile_supported() {
+    if (!GLAD_GL_KHR_parallel_shader_compile && !GLAD_GL_ARB_parallel_shader_compile) return false;
+    void* context = glfwGetCurrentContext();
+    if (m_parallel_compile_contexts.insert(context).second) {
+        // Let the driver pick the number of compiler threads
+        if (GLAD_GL_KHR_parallel_shader_compile) glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        else glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+    return true;
+}
+
+static void _parallel_compile_begin(_pending_program_t& p) {
+    const char* sources[] = { p.vertex_src.c_str(), p.fragment_src.c_str() };
+    p.vertex = glCreateShader(GX_GLSL_VERTEX_SHADER);
+    p.fragment = glCreateShader(GX_GLSL_FRAGMENT_SHADER);
+    glShaderSource(p.vertex, 1, &sources[0], NULL);
+    glShaderSource(p.fragment, 1, &sources[1], NULL);
+    glCompileShader(p.vertex);
+    glCompileShader(p.fragment);
+}
+
+static void _parallel_link_begin(_pending_program_t& p) {
+    p.result.program = glCreateProgram();
+    if (p.cached) glProgramParameteri(p.result.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glAttachShader(p.result.program, p.vertex);
+    glAttachShader(p.result.program, p.fragment);
+    glLinkProgram(p.result.program);
+}
+
+// Reading any status other than GL_COMPLETION_STATUS_KHR blocks until the driver finished, so `wait` only skips that check
+static bool _parallel_finish(_pending_program_t& p, bool wait) {
+    if (!wait) {
+        GLint complete = 0;
+        glGetProgramiv(p.result.program, GL_COMPLETION_STATUS_KHR, &complete);
+        if (!complete) return false;
+    }
+    GXShaderCompilationResult* results[] = { &p.result.vertex_result, &p.result.fragment_result };
+    uint32_t shaders[] = { p.vertex, p.fragment };
+    for (int i = 0; i < 2; i++) {
+        results[i]->handle = shaders[i];
+        glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &results[i]->success);
+        if (!results[i]->success) glGetShaderInfoLog(shaders[i], sizeof(results[i]->info_log), NULL, results[i]->info_log);
+        glDetachShader(p.result.program, shaders[i]);
+        glDeleteShader(shaders[i]);
+    }
+    glGetProgramiv(p.result.program, GL_LINK_STATUS, &p.result.success);
+    if (!p.result.success) glGetProgramInfoLog(p.result.program, sizeof(p.result.program_log), NULL, p.result.program_log);
+    if (p.cached) {
+        if (p.result.success) _program_cache_store(p.cache_key, p.result.program);
+        _program_cache_record(false, p.start);
+    }
+    p.vertex = p.fragment = 0;
+    p.done = true;
+    return true;
+}
+
+static void _pending_program_release(GXPendingProgram* pending) {
+    auto ptr = (_pending_program_ptr_t*)pending->internal;
+    _pending_program_t& p = **ptr;
+    {
+        std::lock_guard<std::mutex> lock(p.mutex);
+        if (p.parallel && !p.done) {
+            glDeleteShader(p.vertex);
+            glDeleteShader(p.fragment);
+            glDeleteProgram(p.result.program);
+        }
+        else if (p.done && !pending->ready) {
+            if (p.result.program) glDeleteProgram(p.result.program);
+        }
+        else if (!p.done) {
+            p.cancelled = true; // The worker deletes the program once it finished
+        }
+    }
+    delete ptr;
+}
+
+GXPendingProgram* gxAsPendingProgram(GXResource* res) { return static_cast<GXPendingProgram*>(res->resource); }
+
+static GXPendingProgram* _pending_program_create(const GXProgramSources& sources) {
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_PENDING_PROGRAM;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXPendingProgram* pending = new GXPendingProgram{};
+    pending->resource = resource;
+    resource->resource = pending;
+
+    auto ptr = new _pending_program_ptr_t(std::make_shared<_pending_program_t>());
+    _pending_program_t& p = **ptr;
+    p.vertex_src = sources.vertex_shader_src;
+    p.fragment_src = sources.fragment_shader_src;
+    p.start = std::chrono::steady_clock::now();
+    pending->internal = ptr;
+
+    // A cached binary is loaded right away, it does not go through the compiler
+    GXShaderCompilationResult stage_results[2] = {};
+    _program_stage_t stages[] = {
+        { sources.vertex_shader_src, GX_GLSL_VERTEX_SHADER, &stage_results[0] },
+        { sources.fragment_shader_src, GX_GLSL_FRAGMENT_SHADER, &stage_results[1] },
+    };
+    p.cached = _program_cache_lookup(stages, 2, p.cache_key);
+    if (p.cached && _program_cache_load(p.cache_key, p.result)) {
+        p.result.vertex_result.success = p.result.fragment_result.success = 1;
+        _program_cache_record(true, p.start);
+        p.done = true;
+    }
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return pending;
+}
+
+size_t gxCompileGLSLProgramsAsync(const GXProgramSources* sources, size_t count, GXPendingProgram** out_programs) {
+    if (!out_programs) return 0;
+    for (size_t i = 0; i < count; i++) out_programs[i] = nullptr;
+    if (!m_app || !sources || !glfwGetCurrentContext()) return 0;
+
+    bool parallel = _parallel_compile_supported();
+    _shader_worker_pool_t* pool = parallel ? nullptr : _shader_workers();
+    if (!parallel && !pool) return 0;
+
+    size_t started = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!sources[i].vertex_shader_src || !sources[i].fragment_shader_src) continue;
+        out_programs[i] = _pending_program_create(sources[i]);
+        started++;
+        _pending_program_ptr_t ptr = *(_pending_program_ptr_t*)out_programs[i]->internal;
+        if (ptr->done) continue;
+
+        if (parallel) {
+            ptr->parallel = true;
+            _parallel_compile_begin(*ptr);
+            continue;
+        }
+        _shader_workers_submit(pool, [ptr](bool run) {
+            GXProgramCompilationResult result = {};
+            if (run) {
+                result = gxCompileGLSLProgram(ptr->vertex_src.c_str(), ptr->fragment_src.c_str());
+                // Objects created by one context are only guaranteed complete for others after a finish
+                glFinish();
+            }
+            else snprintf(result.program_log, sizeof(result.program_log), "Shader compiler worker shut down before compiling");
+            std::lock_guard<std::mutex> lock(ptr->mutex);
+            if (ptr->cancelled) {
+                if (result.program) glDeleteProgram(result.program);
+                return;
+            }
+            ptr->result = result;
+            ptr->done = true;
+            ptr->cv.notify_all();
+        });
+    }
+
+    // Linking starts after every shader was submitted, so compiles of different programs overlap
+    if (parallel) {
+        for (size_t i = 0; i < count; i++) {
+            if (!out_programs[i]) continue;
+            _pending_program_t& p = **(_pending_program_ptr_t*)out_programs[i]->internal;
+            if (p.parallel) _parallel_link_begin(p);
+        }
+    }
+    return started;
+}
+
+GXPendingProgram* gxCompileGLSLProgramAsync(const char* vertex_shader_src, const char* fragment_shader_src) {
+    GXProgramSources sources = { vertex_shader_src, fragment_shader_src };
+    GXPendingProgram* pending = nullptr;
+    gxCompileGLSLProgramsAsync(&sources, 1, &pending);
+    return pending;
+}
+
+static bool _pending_program_finish(GXPendingProgram* program, bool wait) {
+    if (program->ready) return true;
+    _pending_program_t& p = **(_pending_program_ptr_t*)program->internal;
+    std::unique_lock<std::mutex> lock(p.mutex);
+    if (p.parallel && !p.done) {
+        if (!_parallel_finish(p, wait)) return false;
+    }
+    if (wait) p.cv.wait(lock, [&p] { return p.done; });
+    if (!p.done) return false;
+    program->result = p.result;
+    program->ready = true;
+    return true;
+}
+
+bool gxPollProgram(GXPendingProgram* program) {
+    return program && _pending_program_finish(program, false);
+}
+
+size_t gxPollPrograms(GXPendingProgram** programs, size_t count) {
+    if (!programs) return 0;
+    size_t ready = 0;
+    for (size_t i = 0; i < count; i++) ready += gxPollProgram(programs[i]);
+    return ready;
+}
+
+GXProgramCompilationResult gxWaitProgram(GXPendingProgram* program) {
+    if (!program) return GXProgramCompilationResult{};
+    _pending_program_finish(program, true);
+    return program->result;
+}
+
+struct _shader_watch_t {
+    uint64_t id;
+    GXObject* object;
+    GLFWwindow* context;
+    std::filesystem::path files[2]; // Vertex, fragment
+    std::filesystem::file_time_type mtimes[2];
+    bool dirty, compiling;
+};
+
+struct _shader_reload_t {
+    uint64_t id;
+    GLFWwindow* context;
+    GXProgramCompilationResult result;
+};
+
+struct _shader_watcher_t {
+    std::vector<_shader_watch_t> watches;
+    uint64_t next_id = 1;
+    GXShaderReloadCallback callback = nullptr;
+    std::mutex mutex; // Guards completed, filled by the shader workers
+    std::vector<_shader_reload_t> completed;
+#if defined(__linux__)
+    int inotify = -1;
+    std::unordered_map<int, std::filesystem::path> directories; // Watch descriptor -> directory
+#else
+    double last_poll = 0.0;
+#endif
+};
+static _shader_watcher_t m_shader_watcher;
+
+static std::filesystem::file_time_type _shader_watch_mtime(const std::filesystem::path& file) {
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(file, ec);
+    return ec ? std::filesystem::file_time_type::min() : mtime;
+}
+
+static void _shader_watch_poll() {
+#if defined(__linux__)
+    if (m_shader_watcher.inotify < 0) return;
+    alignas(struct inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(m_shader_watcher.inotify, buffer, sizeof(buffer))) > 0) {
+        for (char* ptr = buffer; ptr < buffer + length;) {
+            const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(ptr);
+            ptr += sizeof(struct inotify_event) + event->len;
+            auto directory = m_shader_watcher.directories.find(event->wd);
+            if (directory == m_shader_watcher.directories.end() || !event->len) continue;
+            std::filesystem::path changed = directory->second / event->name;
+            for (_shader_watch_t& watch : m_shader_watcher.watches) {
+                if (watch.files[0] == changed || watch.files[1] == changed) watch.dirty = true;
+            }
+        }
+    }
+#else
+    double now = glfwGetTime();
+    if (now - m_shader_watcher.last_poll < 0.25) return;
+    m_shader_watcher.last_poll = now;
+    for (_shader_watch_t& watch : m_shader_watcher.watches) {
+        for (int i = 0; i < 2; i++) {
+            auto mtime = _shader_watch_mtime(watch.files[i]);
+            if (mtime != watch.mtimes[i]) {
+                watch.mtimes[i] = mtime;
+                watch.dirty = true;
+            }
+        }
+    }
+#endif
+}
+
+static bool _read_text_file(const std::filesystem::path& path, std::string& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static void _shader_watch_submit(_shader_watch_t& watch) {
+    _shader_worker_pool_t* pool = _shader_workers();
+    if (!pool) return;
+    watch.dirty = false;
+    watch.compiling = true;
+    uint64_t id = watch.id;
+    GLFWwindow* context = watch.context;
+    std::filesystem::path vertex_path = watch.files[0], fragment_path = watch.files[1];
+    _shader_workers_submit(pool, [id, context, vertex_path, fragment_path](bool run) {
+        _shader_reload_t reload = { id, context, {} };
+        std::string sources[2];
+        if (!run) {
+            snprintf(reload.result.program_log, sizeof(reload.result.program_log), "Shader compiler worker shut down before compiling");
+        }
+        else if (!_read_text_file(vertex_path, sources[0]) || !_read_text_file(fragment_path, sources[1])) {
+            snprintf(reload.result.program_log, sizeof(reload.result.program_log), "Failed to read shader files");
+        }
+        else {
+            reload.result = gxCompileGLSLProgram(sources[0].c_str(), sources[1].c_str());
+            glFinish(); // The program is used by the shared context after the swap
+        }
+        std::lock_guard<std::mutex> lock(m_shader_watcher.mutex);
+        m_shader_watcher.completed.push_back(reload);
+    });
+}
+
+// Called by gxExec with the context of the window about to be drawn current
+static void _shader_watch_update(GLFWwindow* context) {
+    if (m_shader_watcher.watches.empty()) {
+        // Recompilations of forgotten watches still have to be collected to delete their programs
+        std::lock_guard<std::mutex> lock(m_shader_watcher.mutex);
+        if (m_shader_watcher.completed.empty()) return;
+    }
+    _shader_watch_poll();
+
+    std::vector<_shader_reload_t> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_shader_watcher.mutex);
+        auto split = std::stable_partition(m_shader_watcher.completed.begin(), m_shader_watcher.completed.end(),
+            [context](const _shader_reload_t& reload) { return reload.context != context; });
+        completed.assign(split, m_shader_watcher.completed.end());
+        m_shader_watcher.completed.erase(split, m_shader_watcher.completed.end());
+    }
+    for (_shader_reload_t& reload : completed) {
+        auto watch = std::find_if(m_shader_watcher.watches.begin(), m_shader_watcher.watches.end(),
+            [&reload](const _shader_watch_t& w) { return w.id == reload.id; });
+        if (watch == m_shader_watcher.watches.end() || !reload.result.success) {
+            if (reload.result.program) glDeleteProgram(reload.result.program);
+            reload.result.program = 0;
+            if (watch == m_shader_watcher.watches.end()) continue;
+        }
+        else {
+            uint32_t previous = watch->object->shader_program;
+            watch->object->shader_program = reload.result.program;
+            auto references = m_bundle_references.find(watch->object->resource);
+            if (references != m_bundle_references.end()) {
+                for (GXRenderBundle* bundle : references->second) bundle->valid = false;
+                m_bundle_references.erase(references);
+            }
+            if (previous) glDeleteProgram(previous);
+        }
+        watch->compiling = false;
+        if (m_shader_watcher.callback) m_shader_watcher.callback(watch->object, &reload.result);
+    }
+
+    for (_shader_watch_t& watch : m_shader_watcher.watches) {
+        if (watch.context == context && watch.dirty && !watch.compiling) _shader_watch_submit(watch);
+    }
+}
+
+// Forgets the watch of `object`, or every watch of `context` if `object` is nullptr
+static void _shader_watch_forget(GXObject* object, GLFWwindow* context) {
+    auto& watches = m_shader_watcher.watches;
+    size_t count = watches.size();
+    watches.erase(std::remove_if(watches.begin(), watches.end(), [object, context](const _shader_watch_t& watch) {
+        return object ? watch.object == object : watch.context == context;
+    }), watches.end());
+    if (!object) {
+        // The programs of a destroyed context are gone with it
+        std::lock_guard<std::mutex> lock(m_shader_watcher.mutex);
+        auto& completed = m_shader_watcher.completed;
+        completed.erase(std::remove_if(completed.begin(), completed.end(),
+            [context](const _shader_reload_t& reload) { return reload.context == context; }), completed.end());
+    }
+    if (count == watches.size() || !watches.empty()) return;
+#if defined(__linux__)
+    if (m_shader_watcher.inotify >= 0) close(m_shader_watcher.inotify);
+    m_shader_watcher.inotify = -1;
+    m_shader_watcher.directories.clear();
+#endif
+}
+
+bool gxWatchShaderFiles(GXObject* object, const char* vertex_shader_path, const char* fragment_shader_path) {
+    GLFWwindow* context = glfwGetCurrentContext();
+    if (!object || !vertex_shader_path || !fragment_shader_path || !context) return false;
+    gxUnwatchShaderFiles(object);
+
+    _shader_watch_t watch = { m_shader_watcher.next_id++, object, context, {}, {}, false, false };
+    std::error_code ec;
+    const char* paths[] = { vertex_shader_path, fragment_shader_path };
+    for (int i = 0; i < 2; i++) {
+        watch.files[i] = std::filesystem::absolute(paths[i], ec).lexically_normal();
+        if (ec) return false;
+        watch.mtimes[i] = _shader_watch_mtime(watch.files[i]);
+    }
+
+#if defined(__linux__)
+    if (m_shader_watcher.inotify < 0) m_shader_watcher.inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_shader_watcher.inotify < 0) return false;
+    // Directories are watched instead of the files, editors commonly save by replacing the file
+    for (const std::filesystem::path& file : watch.files) {
+        std::filesystem::path directory = file.parent_path();
+        int wd = inotify_add_watch(m_shader_watcher.inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (wd < 0) return false;
+        m_shader_watcher.directories[wd] = directory;
+    }
+#endif
+
+    m_shader_watcher.watches.push_back(watch);
+    return true;
+}
+
+void gxUnwatchShaderFiles(GXObject* object) {
+    if (object) _shader_watch_forget(object, nullptr);
+}
+
+void gxSetShaderReloadCallback(GXShaderReloadCallback cb) {
+    m_shader_watcher.callback = cb;
+}
+
+struct _program_reflection_t {
+    std::deque<std::string> names; // Deque elements never move, GXShaderVariable::name points into them
+    std::vector<GXShaderVariable> variables[4];
+    std::unordered_map<uint32_t, uint32_t> lookup[4]; // Name hash -> index into variables, or _REFLECTION_AMBIGUOUS
+};
+
+// Several names of the interface share the hash, the lookup cannot tell which one was meant
+static const uint32_t _REFLECTION_AMBIGUOUS = UINT32_MAX;
+
+static void _program_reflection_release(GXProgramReflection* reflection) {
+    delete (_program_reflection_t*)reflection->internal;
+}
+
+uint32_t gxHashName(const char* name) {
+    uint32_t hash = 0x811C9DC5u;
+    for (; name && *name; name++) {
+        hash ^= static_cast<uint8_t>(*name);
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+GXProgramReflection* gxAsProgramReflection(GXResource* res) { return static_cast<GXProgramReflection*>(res->resource); }
+
+GXProgramReflection* gxReflectProgram(uint32_t program) {
+    if (!m_app || !program) return nullptr;
+    GLint linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) return nullptr;
+
+    _program_reflection_t* reflection = new _program_reflection_t();
+    const GLenum interfaces[] = { GL_UNIFORM, GL_UNIFORM_BLOCK, GL_SHADER_STORAGE_BLOCK, GL_PROGRAM_INPUT };
+    for (int i = 0; i < 4; i++) {
+        auto add_lookup = [&](uint32_t name_hash, uint32_t slot) {
+            auto [it, inserted] = reflection->lookup[i].emplace(name_hash, slot);
+            if (!inserted && it->second != slot) it->second = _REFLECTION_AMBIGUOUS;
+        };
+        GLint count = 0, max_length = 0;
+        glGetProgramInterfaceiv(program, interfaces[i], GL_ACTIVE_RESOURCES, &count);
+        glGetProgramInterfaceiv(program, interfaces[i], GL_MAX_NAME_LENGTH, &max_length);
+        std::vector<char> name(max_length + 1);
+        bool block = i == GX_PROGRAM_INTERFACE_UNIFORM_BLOCK || i == GX_PROGRAM_INTERFACE_STORAGE_BLOCK;
+
+        for (GLint index = 0; index < count; index++) {
+            // Uniforms: location, type, array size, block index. Blocks: binding, data size. Attributes: location, type, array size.
+            const GLenum variable_props[] = { GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE, GL_BLOCK_INDEX };
+            const GLenum block_props[] = { GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE };
+            GLint values[4] = { -1, 0, 0, -1 };
+            if (block) glGetProgramResourceiv(program, interfaces[i], index, 2, block_props, 2, nullptr, values);
+            else glGetProgramResourceiv(program, interfaces[i], index, i == GX_PROGRAM_INTERFACE_UNIFORM ? 4 : 3, variable_props, 4, nullptr, values);
+            // Members of uniform blocks and built-in inputs have no location
+            if (!block && values[0] < 0) continue;
+            glGetProgramResourceName(program, interfaces[i], index, (GLsizei)name.size(), nullptr, name.data());
+
+            const std::string& stored = reflection->names.emplace_back(name.data());
+            GXShaderVariable variable = {};
+            variable.name = stored.c_str();
+            variable.name_hash = gxHashName(variable.name);
+            variable.location = values[0];
+            variable.type = block ? 0 : (uint32_t)values[1];
+            variable.size = block ? values[1] : values[2];
+            uint32_t slot = (uint32_t)reflection->variables[i].size();
+            reflection->variables[i].push_back(variable);
+            add_lookup(variable.name_hash, slot);
+
+            size_t length = stored.size();
+            if (length > 3 && stored.compare(length - 3, 3, "[0]") == 0) {
+                add_lookup(gxHashName(stored.substr(0, length - 3).c_str()), slot);
+            }
+        }
+    }
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_PROGRAM_REFLECTION;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXProgramReflection* result = new GXProgramReflection{};
+    result->resource = resource;
+    result->program = program;
+    result->internal = reflection;
+    for (int i = 0; i < 4; i++) {
+        result->counts[i] = (uint32_t)reflection->variables[i].size();
+        result->variables[i] = reflection->variables[i].data();
+    }
+    resource->resource = result;
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return result;
+}
+
+const GXShaderVariable* gxFindProgramVariable(const GXProgramReflection* reflection, GXProgramInterface program_interface, uint32_t name_hash) {
+    if (!reflection || program_interface > GX_PROGRAM_INTERFACE_ATTRIBUTE) return nullptr;
+    const _program_reflection_t* internal = (const _program_reflection_t*)reflection->internal;
+    auto found = internal->lookup[program_interface].find(name_hash);
+    if (found == internal->lookup[program_interface].end() || found->second == _REFLECTION_AMBIGUOUS) return nullptr;
+    return &internal->variables[program_interface][found->second];
+}
+
+int32_t gxGetUniformLocation(const GXProgramReflection* reflection, uint32_t name_hash) {
+    const GXShaderVariable* uniform = gxFindProgramVariable(reflection, GX_PROGRAM_INTERFACE_UNIFORM, name_hash);
+    return uniform ? uniform->location : -1;
+}
+
+// Samplers, images and booleans are declared with their own types but set like ints
+static bool _uniform_type_matches(uint32_t declared, GXUniformType type) {
+    if (declared == (uint32_t)type) return true;
+    if (type != GX_UNIFORM_TYPE_INT) return false;
+    return declared == GL_BOOL
+        || (declared >= GL_SAMPLER_1D && declared <= GL_SAMPLER_2D_RECT_SHADOW)
+        || (declared >= GL_SAMPLER_1D_ARRAY && declared <= GL_SAMPLER_CUBE_SHADOW) // GL_UNSIGNED_INT_VEC2..4 sit in between
+        || (declared >= GL_INT_SAMPLER_1D && declared <= GL_UNSIGNED_INT_SAMPLER_BUFFER)
+        || (declared >= GL_SAMPLER_2D_MULTISAMPLE && declared <= GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY)
+        || (declared >= GL_SAMPLER_CUBE_MAP_ARRAY && declared <= GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY)
+        || (declared >= GL_IMAGE_1D && declared <= GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY);
+}
+
+bool gxSetUniform(const GXProgramReflection* reflection, uint32_t name_hash, GXUniformType type, int count, const void* data) {
+    const GXShaderVariable* uniform = gxFindProgramVariable(reflection, GX_PROGRAM_INTERFACE_UNIFORM, name_hash);
+    if (!uniform || !data || !_uniform_type_matches(uniform->type, type)) return false;
+    _set_program_uniform(reflection->program, uniform->location, type, count, data);
+    return true;
+}
+
+bool gxSetUniform1f(const GXProgramReflection* reflection, uint32_t name_hash, float x) {
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_FLOAT, 1, &x);
+}
+
+bool gxSetUniform2f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y) {
+    float v[] = { x, y };
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_VEC2, 1, v);
+}
+
+bool gxSetUniform3f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y, float z) {
+    float v[] = { x, y, z };
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_VEC3, 1, v);
+}
+
+bool gxSetUniform4f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y, float z, float w) {
+    float v[] = { x, y, z, w };
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_VEC4, 1, v);
+}
+
+bool gxSetUniform1i(const GXProgramReflection* reflection, uint32_t name_hash, int32_t x) {
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_INT, 1, &x);
+}
+
+bool gxSetUniform1ui(const GXProgramReflection* reflection, uint32_t name_hash, uint32_t x) {
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_UINT, 1, &x);
+}
+
+bool gxSetUniformMat3(const GXProgramReflection* reflection, uint32_t name_hash, const float* m) {
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_MAT3, 1, m);
+}
+
+bool gxSetUniformMat4(const GXProgramReflection* reflection, uint32_t name_hash, const float* m) {
+    return gxSetUniform(reflection, name_hash, GX_UNIFORM_TYPE_MAT4, 1, m);
+}
+
+// Minimal GLSL conditional preprocessor used to collapse shader variants. It resolves #if, #ifdef, #ifndef, #elif,
+// #else and #endif over the variant keywords and the integer macros a source defines, and gives up on anything else.
+struct _glsl_conditionals_t {
+    const std::unordered_set<std::string>& keywords;
+    std::unordered_map<std::string, std::string> macros;
+
+    // 1 if defined, 0 if known to be undefined, -1 if unknown (GL built-in macros are never known)
+    int defined(const std::string& name) const {
+        if (macros.count(name)) return 1;
+        return keywords.count(name) ? 0 : -1;
+    }
+};
+
+static bool _glsl_identifier_start(char c) { return isalpha(static_cast<unsigned char>(c)) || c == '_'; }
+static bool _glsl_identifier_char(char c) { return isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+
+struct _glsl_expression_t {
+    const _glsl_conditionals_t& state;
+    const char* p;
+    bool failed = false;
+
+    void skip() { while (*p == ' ' || *p == '\t') p++; }
+    bool accept(const char* op) {
+        skip();
+        size_t length = strlen(op);
+        if (strncmp(p, op, length) != 0) return false;
+        p += length;
+        return true;
+    }
+    std::string identifier() {
+        skip();
+        const char* start = p;
+        if (!_glsl_identifier_start(*p)) {
+            failed = true;
+            return {};
+        }
+        while (_glsl_identifier_char(*p)) p++;
+        return std::string(start, p);
+    }
+    long long primary() {
+        if (failed) return 0;
+        if (accept("!")) return !primary();
+        if (accept("(")) {
+            long long value = logical_or();
+            if (!accept(")")) failed = true;
+            return value;
+        }
+        skip();
+        if (isdigit(static_cast<unsigned char>(*p))) {
+            char* end;
+            long long value = strtoll(p, &end, 0);
+            p = end;
+            while (*p == 'u' || *p == 'U') p++;
+            return value;
+        }
+        std::string name = identifier();
+        if (failed) return 0;
+        if (name == "defined") {
+            bool parenthesized = accept("(");
+            int defined = state.defined(identifier());
+            if (parenthesized && !accept(")")) failed = true;
+            if (defined < 0) failed = true;
+            return defined > 0;
+        }
+        auto macro = state.macros.find(name);
+        if (macro == state.macros.end()) {
+            if (!state.keywords.count(name)) failed = true;
+            return 0;
+        }
+        char* end;
+        long long value = strtoll(macro->second.c_str(), &end, 0);
+        if (macro->second.empty() || *end) failed = true;
+        return value;
+    }
+    long long comparison() {
+        long long value = primary();
+        for (;;) {
+            if (accept("==")) value = value == primary();
+            else if (accept("!=")) value = value != primary();
+            else if (accept("<=")) value = value <= primary();
+            else if (accept(">=")) value = value >= primary();
+            else if (accept("<")) value = value < primary();
+            else if (accept(">")) value = value > primary();
+            else return value;
+        }
+    }
+    long long logical_and() {
+        long long value = comparison();
+        while (accept("&&")) value = comparison() && value;
+        return value;
+    }
+    long long logical_or() {
+        long long value = logical_and();
+        while (accept("||")) value = logical_and() || value;
+        return value;
+    }
+};
+
+// Inactive lines are blanked instead of removed so compiler messages keep their line numbers.
+// `identifiers` receives the identifiers of every line that remains, conditional directives excluded.
+static bool _glsl_resolve_conditionals(const std::string& src, const std::unordered_set<std::string>& keywords, const std::vector<std::string>& enabled,
+    std::string& out, std::unordered_set<std::string>& identifiers) {
+    _glsl_conditionals_t state = { keywords, {} };
+    for (const std::string& keyword : enabled) state.macros[keyword] = "1";
+
+    struct level_t { bool parent, taken, active; };
+    std::vector<level_t> levels;
+    auto evaluate = [&state](const std::string& expression, bool& failed) {
+        _glsl_expression_t parser = { state, expression.c_str() };
+        long long value = parser.logical_or();
+        parser.skip();
+        failed = parser.failed || *parser.p;
+        return value != 0;
+    };
+
+    out.clear();
+    size_t start = 0;
+    while (start <= src.size()) {
+        size_t end = src.find('\n', start);
+        if (end == std::string::npos) end = src.size();
+        std::string line = src.substr(start, end - start);
+        bool last = end == src.size();
+        start = end + 1;
+
+        bool active = levels.empty() || levels.back().active;
+        size_t hash = line.find_first_not_of(" \t");
+        bool keep = active, conditional = false;
+        if (hash != std::string::npos && line[hash] == '#') {
+            if (!line.empty() && (line.back() == '\\' || (line.size() > 1 && line.back() == '\r' && line[line.size() - 2] == '\\'))) return false;
+            if (line.find("/*") != std::string::npos) return false;
+            std::string text = line.substr(hash + 1, line.find("//") == std::string::npos ? std::string::npos : line.find("//") - hash - 1);
+            while (!text.empty() && isspace(static_cast<unsigned char>(text.back()))) text.pop_back();
+            size_t name_start = text.find_first_not_of(" \t");
+            size_t name_end = name_start == std::string::npos ? std::string::npos : text.find_first_of(" \t(", name_start);
+            std::string directive = name_start == std::string::npos ? std::string() : text.substr(name_start, name_end - name_start);
+            std::string rest = name_end == std::string::npos ? std::string() : text.substr(name_end);
+            rest.erase(0, rest.find_first_not_of(" \t") == std::string::npos ? rest.size() : rest.find_first_not_of(" \t"));
+
+            bool failed = false;
+            conditional = directive == "if" || directive == "ifdef" || directive == "ifndef" || directive == "elif" || directive == "else" || directive == "endif";
+            if (directive == "if" || directive == "ifdef" || directive == "ifndef") {
+                bool condition = false;
+                if (active) {
+                    if (directive == "if") condition = evaluate(rest, failed);
+                    else {
+                        int defined = state.defined(rest);
+                        failed = defined < 0;
+                        condition = (defined > 0) == (directive == "ifdef");
+                    }
+                }
+                levels.push_back({ active, condition, condition });
+            }
+            else if (directive == "elif" || directive == "else") {
+                if (levels.empty()) return false;
+                level_t& level = levels.back();
+                bool condition = level.parent && !level.taken && (directive == "else" || evaluate(rest, failed));
+                level.active = condition;
+                level.taken |= condition;
+            }
+            else if (directive == "endif") {
+                if (levels.empty()) return false;
+                levels.pop_back();
+            }
+            else if (active && (directive == "define" || directive == "undef")) {
+                std::string name = rest.substr(0, rest.find_first_of(" \t("));
+                if (directive == "undef") state.macros.erase(name);
+                else {
+                    std::string body = rest.substr(name.size());
+                    // Function-like macros are stored with a body that never evaluates
+                    if (!body.empty() && body[0] == '(') body = "(";
+                    body.erase(0, body.find_first_not_of(" \t") == std::string::npos ? body.size() : body.find_first_not_of(" \t"));
+                    state.macros[name] = body;
+                }
+            }
+            if (failed) return false;
+            if (conditional) keep = false;
+        }
+
+        if (keep) {
+            for (size_t i = 0; i < line.size();) {
+                size_t token_start = i;
+                if (!_glsl_identifier_char(line[i])) {
+                    i++;
+                    continue;
+                }
+                while (i < line.size() && _glsl_identifier_char(line[i])) i++;
+                // Numbers such as 1e5 are skipped as a whole
+                if (_glsl_identifier_start(line[token_start])) identifiers.insert(line.substr(token_start, i - token_start));
+            }
+            out += line;
+        }
+        if (!last) out += '\n';
+        else break;
+    }
+    return levels.empty();
+}
+
+static std::string _glsl_inject_defines(const std::string& src, const std::vector<std::string>& defines) {
+    std::string block;
+    for (const std::string& define : defines) block += "#define " + define + " 1\n";
+    if (block.empty()) return src;
+
+    // Defines go right after #version, which has to stay the first directive
+    for (size_t start = 0; start < src.size();) {
+        size_t end = src.find('\n', start);
+        size_t hash = src.find_first_not_of(" \t", start);
+        if (hash != std::string::npos && hash < end && src[hash] == '#') {
+            size_t name = src.find_first_not_of(" \t", hash + 1);
+            if (name != std::string::npos && src.compare(name, 7, "version") == 0) {
+                if (end == std::string::npos) return src + "\n" + block;
+                return src.substr(0, end + 1) + block + src.substr(end + 1);
+            }
+        }
+        if (end == std::string::npos) break;
+        start = end + 1;
+    }
+    return block + src;
+}
+
+struct _shader_variant_set_t {
+    std::string sources[2];
+    std::vector<std::string> keywords;
+    std::unordered_set<std::string> keyword_set;
+    std::deque<GXProgramCompilationResult> programs; // Deque elements never move, results are handed out by pointer
+    std::unordered_map<uint64_t, uint32_t> by_source; // Hash of the preprocessed sources -> program index
+    std::unordered_map<uint64_t, uint32_t> by_mask; // Variant mask -> program index
+};
+
+static void _shader_variant_set_release(GXShaderVariantSet* set) {
+    _shader_variant_set_t* internal = (_shader_variant_set_t*)set->internal;
+    for (const GXProgramCompilationResult& program : internal->programs) {
+        if (program.program) glDeleteProgram(program.program);
+    }
+    delete internal;
+}
+
+static uint64_t _shader_variant_sources(const _shader_variant_set_t& set, uint64_t mask, std::string out[2]) {
+    std::vector<std::string> enabled;
+    for (size_t i = 0; i < set.keywords.size(); i++) {
+        if (mask & (1ull << i)) enabled.push_back(set.keywords[i]);
+    }
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (int stage = 0; stage < 2; stage++) {
+        std::string resolved;
+        std::unordered_set<std::string> identifiers;
+        if (_glsl_resolve_conditionals(set.sources[stage], set.keyword_set, enabled, resolved, identifiers)) {
+            std::vector<std::string> used;
+            for (const std::string& keyword : enabled) {
+                if (identifiers.count(keyword)) used.push_back(keyword);
+            }
+            out[stage] = _glsl_inject_defines(resolved, used);
+        }
+        else out[stage] = _glsl_inject_defines(set.sources[stage], enabled);
+        hash = _fnv1a(hash, out[stage].c_str(), out[stage].size() + 1);
+    }
+    return hash;
+}
+
+GXShaderVariantSet* gxAsShaderVariantSet(GXResource* res) { return static_cast<GXShaderVariantSet*>(res->resource); }
+
+GXShaderVariantSet* gxCreateShaderVariantSet(const char* vertex_shader_src, const char* fragment_shader_src, const char* const* keywords, uint32_t keyword_count) {
+    if (!m_app || !vertex_shader_src || !fragment_shader_src || keyword_count > 64 || (keyword_count && !keywords)) return nullptr;
+    _shader_variant_set_t* internal = new _shader_variant_set_t();
+    internal->sources[0] = vertex_shader_src;
+    internal->sources[1] = fragment_shader_src;
+    for (uint32_t i = 0; i < keyword_count; i++) {
+        internal->keywords.push_back(keywords[i]);
+        internal->keyword_set.insert(keywords[i]);
+    }
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_SHADER_VARIANT_SET;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXShaderVariantSet* set = new GXShaderVariantSet{ resource, keyword_count, 0, 0, internal };
+    resource->resource = set;
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return set;
+}
+
+static uint64_t _shader_variant_mask(const GXShaderVariantSet* set, uint64_t mask) {
+    return set->keyword_count >= 64 ? mask : mask & ((1ull << set->keyword_count) - 1);
+}
+
+uint32_t gxGetShaderVariant(GXShaderVariantSet* set, uint64_t mask) {
+    if (!set) return 0;
+    _shader_variant_set_t* internal = (_shader_variant_set_t*)set->internal;
+    mask = _shader_variant_mask(set, mask);
+    auto variant = internal->by_mask.find(mask);
+    if (variant == internal->by_mask.end()) {
+        std::string sources[2];
+        uint64_t hash = _shader_variant_sources(*internal, mask, sources);
+        auto program = internal->by_source.find(hash);
+        if (program == internal->by_source.end()) {
+            internal->programs.push_back(gxCompileGLSLProgram(sources[0].c_str(), sources[1].c_str()));
+            program = internal->by_source.emplace(hash, (uint32_t)internal->programs.size() - 1).first;
+            set->program_count++;
+        }
+        variant = internal->by_mask.emplace(mask, program->second).first;
+        set->variant_count++;
+    }
+    const GXProgramCompilationResult& result = internal->programs[variant->second];
+    return result.success ? result.program : 0;
+}
+
+const GXProgramCompilationResult* gxGetShaderVariantResult(GXShaderVariantSet* set, uint64_t mask) {
+    if (!set) return nullptr;
+    _shader_variant_set_t* internal = (_shader_variant_set_t*)set->internal;
+    auto variant = internal->by_mask.find(_shader_variant_mask(set, mask));
+    return variant == internal->by_mask.end() ? nullptr : &internal->programs[variant->second];
+}
+
+uint64_t gxShaderVariantKeyword(GXShaderVariantSet* set, const char* keyword) {
+    if (!set || !keyword) return 0;
+    _shader_variant_set_t* internal = (_shader_variant_set_t*)set->internal;
+    for (size_t i = 0; i < internal->keywords.size(); i++) {
+        if (internal->keywords[i] == keyword) return 1ull << i;
+    }
+    return 0;
+}
+
+size_t gxPrewarmShaderVariants(GXShaderVariantSet* set, const uint64_t* masks, size_t count) {
+    if (!set || !masks) return 0;
+    _shader_variant_set_t* internal = (_shader_variant_set_t*)set->internal;
+
+    // Preprocess every new variant first so the distinct programs can be submitted as one batch
+    struct compile_t { uint64_t hash; std::string sources[2]; };
+    std::vector<compile_t> compiles;
+    std::unordered_map<uint64_t, std::vector<uint64_t>> waiting; // Hash -> masks resolving to it
+    for (size_t i = 0; i < count; i++) {
+        uint64_t mask = _shader_variant_mask(set, masks[i]);
+        if (internal->by_mask.count(mask)) continue;
+        compile_t compile;
+        compile.hash = _shader_variant_sources(*internal, mask, compile.sources);
+        auto program = internal->by_source.find(compile.hash);
+        if (program != internal->by_source.end()) {
+            internal->by_mask.emplace(mask, program->second);
+            set->variant_count++;
+            continue;
+        }
+        std::vector<uint64_t>& masks_of_hash = waiting[compile.hash];
+        if (masks_of_hash.empty()) compiles.push_back(std::move(compile));
+        if (std::find(masks_of_hash.begin(), masks_of_hash.end(), mask) == masks_of_hash.end()) masks_of_hash.push_back(mask);
+    }
+
+    std::vector<GXProgramSources> sources(compiles.size());
+    std::vector<GXPendingProgram*> pending(compiles.size(), nullptr);
+    for (size_t i = 0; i < compiles.size(); i++) sources[i] = { compiles[i].sources[0].c_str(), compiles[i].sources[1].c_str() };
+    gxCompileGLSLProgramsAsync(sources.data(), sources.size(), pending.data());
+
+    for (size_t i = 0; i < compiles.size(); i++) {
+        if (pending[i]) {
+            internal->programs.push_back(gxWaitProgram(pending[i]));
+            gxDestroyResource(pending[i]->resource);
+        }
+        else internal->programs.push_back(gxCompileGLSLProgram(sources[i].vertex_shader_src, sources[i].fragment_shader_src));
+        uint32_t index = (uint32_t)internal->programs.size() - 1;
+        internal->by_source.emplace(compiles[i].hash, index);
+        set->program_count++;
+        for (uint64_t mask : waiting[compiles[i].hash]) {
+            internal->by_mask.emplace(mask, index);
+            set->variant_count++;
+        }
+    }
+
+    size_t compiled = 0;
+    for (size_t i = 0; i < count; i++) {
+        auto variant = internal->by_mask.find(_shader_variant_mask(set, masks[i]));
+        compiled += variant != internal->by_mask.end() && internal->programs[variant->second].success;
+    }
+    return compiled;
+}
+
+static GXShaderCompilationResult* _stage_result(GXProgramCompilationResult& result, GXShaderType type) {
+    switch (type) {
+    case GX_GLSL_VERTEX_SHADER: return &result.vertex_result;
+    case GX_GLSL_FRAGMENT_SHADER: return &result.fragment_result;
+    case GX_GLSL_COMPUTE_SHADER: return &result.compute_result;
+    case GX_GLSL_GEOMETRY_SHADER: return &result.geometry_result;
+    case GX_GLSL_TESS_CONTROL_SHADER: return &result.tess_control_result;
+    case GX_GLSL_TESS_EVALUATION_SHADER: return &result.tess_evaluation_result;
+    }
+    return nullptr;
+}
+
+GXProgramCompilationResult gxCompileGLSLSeparableStage(const char* shader_src, GXShaderType shader_type) {
+    GXShaderCompilationResult stage_result = {};
+    _program_stage_t stage = { shader_src, shader_type, &stage_result };
+    GXProgramCompilationResult result = _compile_program(&stage, 1, true);
+    if (GXShaderCompilationResult* member = _stage_result(result, shader_type)) *member = stage_result;
+    return result;
+}
+
+struct _program_pipeline_key_t {
+    void* context;
+    GXPipelineStages stages;
+    bool operator==(const _program_pipeline_key_t& other) const { return context == other.context && !memcmp(&stages, &other.stages, sizeof(stages)); }
+};
+
+struct _program_pipeline_hash_t {
+    size_t operator()(const _program_pipeline_key_t& key) const {
+        return (size_t)_fnv1a(_fnv1a(0xCBF29CE484222325ull, &key.context, sizeof(key.context)), &key.stages, sizeof(key.stages));
+    }
+};
+
+struct _program_pipelines_t {
+    std::unordered_map<_program_pipeline_key_t, uint32_t, _program_pipeline_hash_t> pipelines;
+    std::unordered_map<void*, std::vector<uint32_t>> orphaned; // Pipelines of deleted stages waiting for their context
+};
+static _program_pipelines_t m_program_pipelines;
+
+// The pipelines of a destroyed context are gone with it
+static void _program_pipelines_forget(void* context) {
+    m_program_pipelines.orphaned.erase(context);
+    auto& pipelines = m_program_pipelines.pipelines;
+    for (auto it = pipelines.begin(); it != pipelines.end();) {
+        if (it->first.context == context) it = pipelines.erase(it);
+        else it++;
+    }
+}
+
+// Called by gxExec once `context` is current
+static void _program_pipelines_collect(void* context) {
+    auto orphaned = m_program_pipelines.orphaned.find(context);
+    if (orphaned == m_program_pipelines.orphaned.end()) return;
+    glDeleteProgramPipelines((GLsizei)orphaned->second.size(), orphaned->second.data());
+    m_program_pipelines.orphaned.erase(orphaned);
+}
+
+uint32_t gxGetProgramPipeline(const GXPipelineStages* stages) {
+    void* context = glfwGetCurrentContext();
+    if (!stages || !context) return 0;
+    if (!(stages->vertex || stages->fragment || stages->compute || stages->tess_control || stages->tess_evaluation || stages->geometry)) return 0;
+    _program_pipeline_key_t key = { context, *stages };
+    auto found = m_program_pipelines.pipelines.find(key);
+    if (found != m_program_pipelines.pipelines.end()) return found->second;
+
+    uint32_t pipeline = 0;
+    glCreateProgramPipelines(1, &pipeline);
+    if (stages->vertex) glUseProgramStages(pipeline, GL_VERTEX_SHADER_BIT, stages->vertex);
+    if (stages->fragment) glUseProgramStages(pipeline, GL_FRAGMENT_SHADER_BIT, stages->fragment);
+    if (stages->compute) glUseProgramStages(pipeline, GL_COMPUTE_SHADER_BIT, stages->compute);
+    if (stages->tess_control) glUseProgramStages(pipeline, GL_TESS_CONTROL_SHADER_BIT, stages->tess_control);
+    if (stages->tess_evaluation) glUseProgramStages(pipeline, GL_TESS_EVALUATION_SHADER_BIT, stages->tess_evaluation);
+    if (stages->geometry) glUseProgramStages(pipeline, GL_GEOMETRY_SHADER_BIT, stages->geometry);
+    m_program_pipelines.pipelines.emplace(key, pipeline);
+    return pipeline;
+}
+
+void gxBindProgramPipeline(uint32_t pipeline) {
+    glUseProgram(0);
+    glBindProgramPipeline(pipeline);
+}
+
+void gxDeleteSeparableStage(uint32_t program) {
+    if (!program) return;
+    void* context = glfwGetCurrentContext();
+    auto& pipelines = m_program_pipelines.pipelines;
+    for (auto it = pipelines.begin(); it != pipelines.end();) {
+        const GXPipelineStages& stages = it->first.stages;
+        const uint32_t used[] = { stages.vertex, stages.fragment, stages.compute, stages.tess_control, stages.tess_evaluation, stages.geometry };
+        if (std::find(std::begin(used), std::end(used), program) == std::end(used)) {
+            it++;
+            continue;
+        }
+        if (it->first.context == context) glDeleteProgramPipelines(1, &it->second);
+        else m_program_pipelines.orphaned[it->first.context].push_back(it->second);
+        it = pipelines.erase(it);
+    }
+    glDeleteProgram(program);
+}
+
+bool gxSPIRVSupported() {
+    return GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_gl_spirv;
+}
+
+GXProgramCompilationResult gxCompileSPIRVProgram(const GXSPIRVModule* modules, size_t count) {
+    GXProgramCompilationResult result = {};
+    if (!modules || !count) return result;
+    if (!gxSPIRVSupported()) {
+        snprintf(result.program_log, sizeof(result.program_log), "SPIR-V modules require OpenGL 4.6 or GL_ARB_gl_spirv");
+        return result;
+    }
+
+    _program_cache_key_t key;
+    std::filesystem::path directory;
+    auto start = std::chrono::steady_clock::now();
+    bool cached = _program_cache_available(directory);
+    if (cached) {
+        const char tag[] = "spirv";
+        key = _program_cache_seed();
+        key.directory = std::move(directory);
+        key.add(tag, sizeof(tag));
+        for (size_t i = 0; i < count; i++) {
+            const char* entry_point = modules[i].entry_point ? modules[i].entry_point : "main";
+            key.add(&modules[i].type, sizeof(modules[i].type));
+            key.add(entry_point, strlen(entry_point) + 1);
+            key.add(modules[i].code, modules[i].size);
+            key.add(&modules[i].constant_count, sizeof(modules[i].constant_count));
+            if (modules[i].constant_count) key.add(modules[i].constants, modules[i].constant_count * sizeof(GXSpecializationConstant));
+        }
+        if (_program_cache_load(key, result)) {
+            for (size_t i = 0; i < count; i++) {
+                if (GXShaderCompilationResult* stage = _stage_result(result, modules[i].type)) stage->success = 1;
+            }
+            _program_cache_record(true, start);
+            return result;
+        }
+    }
+
+    std::vector<uint32_t> shaders, ids, values;
+    bool compiled = true;
+    for (size_t i = 0; i < count; i++) {
+        const GXSPIRVModule& module = modules[i];
+        GXShaderCompilationResult* stage = _stage_result(result, module.type);
+        uint32_t shader = glCreateShader(module.type);
+        shaders.push_back(shader);
+        glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, module.code, (GLsizei)module.size);
+
+        ids.clear();
+        values.clear();
+        for (uint32_t c = 0; c < module.constant_count; c++) {
+            ids.push_back(module.constants[c].id);
+            values.push_back(module.constants[c].value);
+        }
+        const char* entry_point = module.entry_point ? module.entry_point : "main";
+        if (GLAD_GL_VERSION_4_6) glSpecializeShader(shader, entry_point, module.constant_count, ids.data(), values.data());
+        else glSpecializeShaderARB(shader, entry_point, module.constant_count, ids.data(), values.data());
+
+        GXShaderCompilationResult status = {};
+        status.handle = shader;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &status.success);
+        if (!status.success) glGetShaderInfoLog(shader, sizeof(status.info_log), NULL, status.info_log);
+        if (stage) *stage = status;
+        compiled = compiled && status.success;
+    }
+    if (compiled) {
+        result.program = glCreateProgram();
+        if (cached) glProgramParameteri(result.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        for (uint32_t shader : shaders) glAttachShader(result.program, shader);
+        glLinkProgram(result.program);
+        glGetProgramiv(result.program, GL_LINK_STATUS, &result.success);
+        if (!result.success) glGetProgramInfoLog(result.program, sizeof(result.program_log), NULL, result.program_log);
+        for (uint32_t shader : shaders) glDetachShader(result.program, shader);
+    }
+    for (uint32_t shader : shaders) glDeleteShader(shader);
+
+    if (cached) {
+        if (result.success) _program_cache_store(key, result.program);
+        _program_cache_record(false, start);
+    }
+    return result;
+}
+
+GXProgramCompilationResult gxCompileGLSLProgramStages(const GXProgramStageSources* sources) {
+    GXProgramCompilationResult result = {};
+    if (!sources || !sources->vertex_shader_src) return result;
+
+    // Stage results are collected apart, _compile_program resets them before compiling
+    GXProgramCompilationResult stage_results = {};
+    const std::pair<const char*, GXShaderType> candidates[] = {
+        { sources->vertex_shader_src, GX_GLSL_VERTEX_SHADER },
+        { sources->tess_control_shader_src, GX_GLSL_TESS_CONTROL_SHADER },
+        { sources->tess_evaluation_shader_src, GX_GLSL_TESS_EVALUATION_SHADER },
+        { sources->geometry_shader_src, GX_GLSL_GEOMETRY_SHADER },
+        { sources->fragment_shader_src, GX_GLSL_FRAGMENT_SHADER },
+    };
+    _program_stage_t stages[5];
+    size_t count = 0;
+    for (const auto& candidate : candidates) {
+        if (candidate.first) stages[count++] = { candidate.first, candidate.second, _stage_result(stage_results, candidate.second) };
+    }
+
+    result = _compile_program(stages, count);
+    for (size_t i = 0; i < count; i++) *_stage_result(result, stages[i].type) = *stages[i].result;
+    return result;
+}
+
+void gxSetPatchVertices(int count) {
+    glPatchParameteri(GL_PATCH_VERTICES, count);
+}
+
+void gxSetPatchDefaultLevels(const float* outer, const float* inner) {
+    if (outer) glPatchParameterfv(GL_PATCH_DEFAULT_OUTER_LEVEL, outer);
+    if (inner) glPatchParameterfv(GL_PATCH_DEFAULT_INNER_LEVEL, inner);
+}
+
+struct _hitch_tracker_t {
+    std::unordered_set<uint64_t> seen;
+    std::vector<GXHitchRecord> records;
+    std::unordered_map<GXObject*, uint64_t> layouts; // Vertex layout hash of each drawn object, reading it back costs a query per attribute
+};
+static _hitch_tracker_t m_hitch;
+
+// Called whenever gx changes a vertex layout, `nullptr` forgets every object
+static void _hitch_forget_layout(GXObject* object) {
+    if (object) m_hitch.layouts.erase(object);
+    else m_hitch.layouts.clear();
+}
+
+// Vertex fetch formats only, drivers specialize on them but not on buffer bindings
+static uint64_t _layout_hash(const GXVertexLayout* layout) {
+    uint64_t hash = 14695981039346656037ull;
+    if (!layout) return hash;
+    std::vector<GXVertexAttribute> attributes(layout->attributes, layout->attributes + layout->attribute_count);
+    std::sort(attributes.begin(), attributes.end(), [](const GXVertexAttribute& a, const GXVertexAttribute& b) { return a.location < b.location; });
+    for (const auto& attribute : attributes) {
+        int32_t fields[] = { (int32_t)attribute.location, attribute.size, (int32_t)attribute.type, attribute.normalized, attribute.integer };
+        hash = _fnv1a(hash, fields, sizeof(fields));
+    }
+    return hash;
+}
+
+static uint64_t _vao_layout_hash(uint32_t vao) {
+    uint64_t hash = 14695981039346656037ull;
+    int max_attributes = 0;
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &max_attributes);
+    for (int i = 0; i < max_attributes; i++) {
+        int enabled = 0;
+        glGetVertexArrayIndexediv(vao, i, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+        if (!enabled) continue;
+        int32_t fields[5] = { i };
+        glGetVertexArrayIndexediv(vao, i, GL_VERTEX_ATTRIB_ARRAY_SIZE, &fields[1]);
+        glGetVertexArrayIndexediv(vao, i, GL_VERTEX_ATTRIB_ARRAY_TYPE, &fields[2]);
+        glGetVertexArrayIndexediv(vao, i, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &fields[3]);
+        glGetVertexArrayIndexediv(vao, i, GL_VERTEX_ATTRIB_ARRAY_INTEGER, &fields[4]);
+        hash = _fnv1a(hash, fields, sizeof(fields));
+    }
+    return hash;
+}
+
+static uint64_t _draw_key(uint32_t program, uint64_t layout_hash, const GXRenderState& state) {
+    uint32_t fields[] = {
+        program, (uint32_t)state.primitive, state.index_type,
+        state.depth_test, state.depth_write, state.cull_face, state.blend,
+        state.blend ? state.blend_src : 0u, state.blend ? state.blend_dst : 0u,
+    };
+    return _fnv1a(layout_hash, fields, sizeof(fields));
+}
+
+static void _hitch_tracked_draw(GXObject* object, GXPrimitiveType primitive, uint32_t index_type, const std::function<void()>& draw) {
+    int program = 0, src = 0, dst = 0;
+    GLboolean depth_write = GL_FALSE;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+    glGetBooleanv(GL_DEPTH_WRITEMASK, &depth_write);
+    glGetIntegerv(GL_BLEND_SRC_RGB, &src);
+    glGetIntegerv(GL_BLEND_DST_RGB, &dst);
+
+    GXRenderState state = {};
+    state.primitive = primitive;
+    state.index_type = index_type;
+    state.depth_test = glIsEnabled(GL_DEPTH_TEST);
+    state.depth_write = depth_write;
+    state.blend = glIsEnabled(GL_BLEND);
+    state.cull_face = glIsEnabled(GL_CULL_FACE);
+    state.blend_src = state.blend ? src : 0;
+    state.blend_dst = state.blend ? dst : 0;
+
+    // Combinations first seen outside of a frame are loading work, not hitches
+    auto layout = m_hitch.layouts.find(object);
+    if (layout == m_hitch.layouts.end()) layout = m_hitch.layouts.emplace(object, _vao_layout_hash(object->vao)).first;
+    bool first = m_hitch.seen.insert(_draw_key(program, layout->second, state)).second;
+    if (!first || !m_current_window) {
+        draw();
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    draw();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    m_hitch.records.push_back({ (uint32_t)program, object->vao, state, m_frame_index, ms });
+}
+
+static int _primitive_vertex_count(GXPrimitiveType primitive) {
+    switch (primitive) {
+    case GX_PRIMITIVE_POINTS: return 1;
+    case GX_PRIMITIVE_LINES:
+    case GX_PRIMITIVE_LINE_LOOP:
+    case GX_PRIMITIVE_LINE_STRIP: return 2;
+    case GX_PRIMITIVE_LINES_ADJACENCY:
+    case GX_PRIMITIVE_LINE_STRIP_ADJACENCY: return 4;
+    case GX_PRIMITIVE_TRIANGLES_ADJACENCY:
+    case GX_PRIMITIVE_TRIANGLE_STRIP_ADJACENCY: return 6;
+    case GX_PRIMITIVE_PATCHES: {
+        int vertices = 3;
+        glGetIntegerv(GL_PATCH_VERTICES, &vertices);
+        return vertices;
+    }
+    default: return 3;
+    }
+}
+
+static size_t _index_type_size(uint32_t type) {
+    switch (type) {
+    case GX_VERTEX_ATTRIB_TYPE_UNSIGNED_BYTE: return 1;
+    case GX_VERTEX_ATTRIB_TYPE_UNSIGNED_SHORT: return 2;
+    default: return 4;
+    }
+}
+
+size_t gxPrewarm(const GXPrewarmEntry* entries, size_t count) {
+    if (!entries || !count) return 0;
+
+    int program = 0, vao = 0, framebuffer = 0, array_buffer = 0, viewport[4] = {};
+    int src_rgb = 0, dst_rgb = 0, src_alpha = 0, dst_alpha = 0;
+    GLboolean depth_write = GL_TRUE;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vao);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &array_buffer);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glGetIntegerv(GL_BLEND_SRC_RGB, &src_rgb);
+    glGetIntegerv(GL_BLEND_DST_RGB, &dst_rgb);
+    glGetIntegerv(GL_BLEND_SRC_ALPHA, &src_alpha);
+    glGetIntegerv(GL_BLEND_DST_ALPHA, &dst_alpha);
+    glGetBooleanv(GL_DEPTH_WRITEMASK, &depth_write);
+    bool depth_test = glIsEnabled(GL_DEPTH_TEST), blend = glIsEnabled(GL_BLEND), cull_face = glIsEnabled(GL_CULL_FACE);
+
+    // One 4x4 target per (color format, depth format, samples), FBOs are not shared between contexts so they only live for this call
+    struct target_t { uint32_t framebuffer, color, depth; };
+    std::unordered_map<uint64_t, target_t> targets;
+    std::vector<uint8_t> zeros;
+    size_t drawn = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const GXPrewarmEntry& entry = entries[i];
+        const GXRenderState& state = entry.state;
+        if (!entry.program) continue;
+
+        uint32_t color_format = state.color_format ? state.color_format : GL_RGBA8;
+        uint64_t target_key = (uint64_t(color_format) << 32) ^ (uint64_t(state.depth_format) << 8) ^ uint64_t(state.samples & 0xFF);
+        auto target = targets.find(target_key);
+        if (target == targets.end()) {
+            target_t t = {};
+            glGenFramebuffers(1, &t.framebuffer);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, t.framebuffer);
+            glGenRenderbuffers(1, &t.color);
+            glBindRenderbuffer(GL_RENDERBUFFER, t.color);
+            glRenderbufferStorageMultisample(GL_RENDERBUFFER, state.samples, color_format, 4, 4);
+            glFramebufferRenderbuffer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, t.color);
+            if (state.depth_format) {
+                glGenRenderbuffers(1, &t.depth);
+                glBindRenderbuffer(GL_RENDERBUFFER, t.depth);
+                glRenderbufferStorageMultisample(GL_RENDERBUFFER, state.samples, state.depth_format, 4, 4);
+                bool stencil = state.depth_format == GL_DEPTH24_STENCIL8 || state.depth_format == GL_DEPTH32F_STENCIL8;
+                glFramebufferRenderbuffer(GL_DRAW_FRAMEBUFFER, stencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, t.depth);
+            }
+            glBindRenderbuffer(GL_RENDERBUFFER, 0);
+            target = targets.emplace(target_key, t).first;
+        }
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target->second.framebuffer);
+        if (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) continue;
+        glViewport(0, 0, 4, 4);
+
+        state.depth_test ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+        glDepthMask(state.depth_write ? GL_TRUE : GL_FALSE);
+        state.cull_face ? glEnable(GL_CULL_FACE) : glDisable(GL_CULL_FACE);
+        state.blend ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+        if (state.blend) glBlendFunc(state.blend_src, state.blend_dst);
+        glUseProgram(entry.program);
+
+        // Zeroed vertices collapse to degenerate primitives, the draw still makes the driver build its variant
+        int vertices = _primitive_vertex_count(state.primitive);
+        size_t stride = entry.layout ? std::max<size_t>(entry.layout->stride, 64) : 64;
+        zeros.assign(stride * vertices, 0);
+
+        uint32_t warm_vao = 0, buffers[2] = {};
+        glGenVertexArrays(1, &warm_vao);
+        glBindVertexArray(warm_vao);
+        glGenBuffers(2, buffers);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+        glBufferData(GL_ARRAY_BUFFER, zeros.size(), zeros.data(), GL_STATIC_DRAW);
+        for (uint32_t a = 0; entry.layout && a < entry.layout->attribute_count; a++) {
+            const GXVertexAttribute& attribute = entry.layout->attributes[a];
+            glEnableVertexAttribArray(attribute.location);
+            if (attribute.integer) {
+                glVertexAttribIPointer(attribute.location, attribute.size, attribute.type, entry.layout->stride, (const void*)(uintptr_t)attribute.offset);
+            } else {
+                glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized, entry.layout->stride, (const void*)(uintptr_t)attribute.offset);
+            }
+        }
+
+        if (state.index_type) {
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, _index_type_size(state.index_type) * vertices, zeros.data(), GL_STATIC_DRAW);
+            glDrawElements(state.primitive, vertices, state.index_type, nullptr);
+        } else {
+            glDrawArrays(state.primitive, 0, vertices);
+        }
+
+        glBindVertexArray(0);
+        glDeleteVertexArrays(1, &warm_vao);
+        glDeleteBuffers(2, buffers);
+
+        m_hitch.seen.insert(_draw_key(entry.program, _layout_hash(entry.layout), state));
+        drawn++;
+    }
+
+    // Deferred compiles finish on the driver side before loading is reported done
+    glFinish();
+
+    for (auto& target : targets) {
+        glDeleteFramebuffers(1, &target.second.framebuffer);
+        uint32_t renderbuffers[] = { target.second.color, target.second.depth };
+        glDeleteRenderbuffers(2, renderbuffers);
+    }
+
+    glUseProgram(program);
+    glBindVertexArray(vao);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, array_buffer);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    depth_test ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+    glDepthMask(depth_write);
+    blend ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+    cull_face ? glEnable(GL_CULL_FACE) : glDisable(GL_CULL_FACE);
+    glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha);
+    return drawn;
+}
+
+void gxEnableHitchTracking(bool enable) {
+    m_hitch_tracking = enable;
+}
+
+size_t gxGetHitchReport(GXHitchRecord* out_records, size_t capacity) {
+    if (!out_records) return m_hitch.records.size();
+    size_t count = std::min(capacity, m_hitch.records.size());
+    std::copy(m_hitch.records.begin(), m_hitch.records.begin() + count, out_records);
+    return count;
+}
+
+void gxClearHitchReport() {
+    m_hitch.seen.clear();
+    m_hitch.records.clear();
+    m_hitch.layouts.clear();
+}
+
+struct _readback_slot_t {
+    uint32_t buffer = 0;
+    size_t capacity = 0;
+    GLsync fence = nullptr;
+    uint64_t ticket = 0;
+    bool mapped = false, consumed = true;
+    const void* data = nullptr;
+    GXReadbackResult result = {};
+};
+
+struct _readback_ring_t {
+    std::vector<_readback_slot_t> slots;
+    uint64_t next_ticket = 1;
+};
+
+struct _pixel_format_t { uint32_t format, type, size; };
+
+static _pixel_format_t _pixel_format(GXPixelFormat format) {
+    switch (format) {
+    case GX_PIXEL_FORMAT_BGRA8: return { GL_BGRA, GL_UNSIGNED_BYTE, 4 };
+    case GX_PIXEL_FORMAT_RGB8: return { GL_RGB, GL_UNSIGNED_BYTE, 3 };
+    case GX_PIXEL_FORMAT_R8: return { GL_RED, GL_UNSIGNED_BYTE, 1 };
+    case GX_PIXEL_FORMAT_RGBA16F: return { GL_RGBA, GL_HALF_FLOAT, 8 };
+    case GX_PIXEL_FORMAT_RGBA32F: return { GL_RGBA, GL_FLOAT, 16 };
+    case GX_PIXEL_FORMAT_DEPTH32F: return { GL_DEPTH_COMPONENT, GL_FLOAT, 4 };
+    default: return { GL_RGBA, GL_UNSIGNED_BYTE, 4 };
+    }
+}
+
+static void _readback_ring_release(GXReadbackRing* ring) {
+    auto internal = static_cast<_readback_ring_t*>(ring->internal);
+    for (auto& slot : internal->slots) {
+        if (slot.mapped) glUnmapNamedBuffer(slot.buffer);
+        if (slot.fence) glDeleteSync(slot.fence);
+        if (slot.buffer) glDeleteBuffers(1, &slot.buffer);
+    }
+    delete internal;
+}
+
+static _readback_slot_t* _readback_slot(GXReadbackRing* ring, uint64_t ticket) {
+    if (!ring || !ticket) return nullptr;
+    auto internal = static_cast<_readback_ring_t*>(ring->internal);
+    _readback_slot_t& slot = internal->slots[(ticket - 1) % internal->slots.size()];
+    return slot.ticket == ticket ? &slot : nullptr;
+}
+
+GXReadbackRing* gxAsReadbackRing(GXResource* res) { return static_cast<GXReadbackRing*>(res->resource); }
+
+GXReadbackRing* gxCreateReadbackRing(uint32_t slot_count) {
+    if (!m_app || !slot_count) return nullptr;
+
+    _readback_ring_t* internal = new _readback_ring_t();
+    internal->slots.resize(slot_count);
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_READBACK_RING;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXReadbackRing* ring = new GXReadbackRing{ resource, slot_count, 0, internal };
+    resource->resource = ring;
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return ring;
+}
+
+uint64_t gxReadPixelsAsync(GXReadbackRing* ring, uint32_t framebuffer, int x, int y, int width, int height, GXPixelFormat format) {
+    if (!ring || width <= 0 || height <= 0) return 0;
+    auto internal = static_cast<_readback_ring_t*>(ring->internal);
+    uint64_t ticket = internal->next_ticket;
+    _readback_slot_t& slot = internal->slots[(ticket - 1) % internal->slots.size()];
+    if (slot.mapped) return 0;
+
+    if (slot.fence) {
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+    }
+    if (!slot.consumed) ring->dropped++;
+
+    _pixel_format_t pixel = _pixel_format(format);
+    size_t row_pitch = size_t(width) * pixel.size;
+    size_t size = row_pitch * height;
+    if (!slot.buffer) glCreateBuffers(1, &slot.buffer);
+    if (slot.capacity < size) {
+        // Buffer storage would be immutable, the slot grows with the largest read instead
+        glNamedBufferData(slot.buffer, size, nullptr, GL_STREAM_READ);
+        slot.capacity = size;
+    }
+
+    int read_framebuffer = 0, pack_buffer = 0, pack_alignment = 4, pack_row_length = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read_framebuffer);
+    glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pack_buffer);
+    glGetIntegerv(GL_PACK_ALIGNMENT, &pack_alignment);
+    glGetIntegerv(GL_PACK_ROW_LENGTH, &pack_row_length);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    // The copy into the pack buffer is queued, only mapping it waits for the GPU
+    glReadPixels(x, y, width, height, pixel.format, pixel.type, nullptr);
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, pack_alignment);
+    glPixelStorei(GL_PACK_ROW_LENGTH, pack_row_length);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pack_buffer);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, read_framebuffer);
+
+    slot.ticket = ticket;
+    slot.consumed = false;
+    slot.result = { nullptr, size, width, height, format, row_pitch, m_frame_index };
+    internal->next_ticket++;
+    return ticket;
+}
+
+uint64_t gxReadWindowPixelsAsync(GXReadbackRing* ring, GXWindow* win, GXPixelFormat format) {
+    if (!win) return 0;
+    int width = 0, height = 0;
+    glfwGetFramebufferSize(static_cast<GLFWwindow*>(win->internal), &width, &height);
+    return gxReadPixelsAsync(ring, 0, 0, 0, width, height, format);
+}
+
+bool gxReadbackReady(GXReadbackRing* ring, uint64_t ticket) {
+    _readback_slot_t* slot = _readback_slot(ring, ticket);
+    if (!slot) return false;
+    if (slot->mapped || !slot->fence) return true;
+    GLenum status = glClientWaitSync(slot->fence, 0, 0);
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+bool gxMapReadback(GXReadbackRing* ring, uint64_t ticket, bool wait, GXReadbackResult* out_result) {
+    _readback_slot_t* slot = _readback_slot(ring, ticket);
+    if (!slot || !out_result) return false;
+
+    if (!slot->mapped) {
+        if (slot->fence) {
+            GLenum status = glClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            while (wait && status == GL_TIMEOUT_EXPIRED) status = glClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) return false;
+            glDeleteSync(slot->fence);
+            slot->fence = nullptr;
+        }
+        slot->data = glMapNamedBufferRange(slot->buffer, 0, slot->result.size, GL_MAP_READ_BIT);
+        if (!slot->data) return false;
+        slot->mapped = true;
+        slot->consumed = true;
+    }
+
+    *out_result = slot->result;
+    out_result->data = slot->data;
+    return true;
+}
+
+void gxUnmapReadback(GXReadbackRing* ring, uint64_t ticket) {
+    _readback_slot_t* slot = _readback_slot(ring, ticket);
+    if (!slot || !slot->mapped) return;
+    glUnmapNamedBuffer(slot->buffer);
+    slot->mapped = false;
+    slot->data = nullptr;
+}
+
+// Returns true if the user given printf `pattern` takes exactly `count` integer arguments with the `length` modifier,
+// anything else (strings, '*' widths, other lengths) would read arguments that are not passed
+static bool _file_pattern_valid(const char* pattern, const char* length, int count) {
+    size_t length_size = strlen(length);
+    int found = 0;
+    for (const char* c = pattern; *c; c++) {
+        if (*c != '%') continue;
+        if (*++c == '%') continue;
+        while (*c && strchr("-+ #0", *c)) c++;
+        while (isdigit((unsigned char)*c)) c++;
+        if (*c == '.') {
+            c++;
+            while (isdigit((unsigned char)*c)) c++;
+        }
+        if (strncmp(c, length, length_size) != 0) return false;
+        c += length_size;
+        if (!*c || !strchr("diouxX", *c)) return false;
+        found++;
+    }
+    return found == count;
+}
+
+struct _capture_frame_t {
+    uint64_t sequence;
+    int width, height;
+    std::vector<uint8_t> pixels;  // RGBA8, top to bottom
+};
+
+struct _capture_t {
+    std::string path;
+    GXReadbackRing ring = {};     // Owned by the capture, not registered as a resource
+    std::deque<uint64_t> readbacks;
+    FILE* stream = nullptr;
+    bool pipe = false;
+    int stream_width = 0, stream_height = 0;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable queue_cv, space_cv, idle_cv;
+    std::deque<_capture_frame_t> queue;
+    uint32_t capacity = 8, busy = 0;
+    uint64_t next_sequence = 0;
+    bool stop = false;
+
+    // Streams are written in sequence order whatever worker encoded the frame
+    std::mutex write_mutex;
+    std::condition_variable write_cv;
+    uint64_t next_write = 0;
+
+    uint64_t captured = 0, written = 0, dropped = 0, failed = 0;
+    double encode_ms = 0.0;
+    std::deque<std::chrono::steady_clock::time_point> recent_writes;
+    std::chrono::steady_clock::time_point first_write;
+};
+
+// Full range BT.601, the color space the C420jpeg chroma siting implies
+static void _capture_rgba_to_yuv420(const _capture_frame_t& frame, std::vector<uint8_t>& out) {
+    int w = frame.width, h = frame.height, cw = (w + 1) / 2, ch = (h + 1) / 2;
+    out.resize(size_t(w) * h + size_t(cw) * ch * 2);
+    uint8_t* y_plane = out.data();
+    uint8_t* u_plane = y_plane + size_t(w) * h;
+    uint8_t* v_plane = u_plane + size_t(cw) * ch;
+    const uint8_t* rgba = frame.pixels.data();
+
+    for (int i = 0; i < w * h; i++) {
+        const uint8_t* p = rgba + size_t(i) * 4;
+        y_plane[i] = uint8_t((19595 * p[0] + 38470 * p[1] + 7471 * p[2] + 32768) >> 16);
+    }
+    for (int cy = 0; cy < ch; cy++) {
+        for (int cx = 0; cx < cw; cx++) {
+            int r = 0, g = 0, b = 0, n = 0;
+            for (int dy = 0; dy < 2 && cy * 2 + dy < h; dy++) {
+                for (int dx = 0; dx < 2 && cx * 2 + dx < w; dx++) {
+                    const uint8_t* p = rgba + (size_t(cy * 2 + dy) * w + cx * 2 + dx) * 4;
+                    r += p[0]; g += p[1]; b += p[2]; n++;
+                }
+            }
+            r /= n; g /= n; b /= n;
+            u_plane[cy * cw + cx] = uint8_t(std::clamp((-11059 * r - 21709 * g + 32768 * b + 8421376) >> 16, 0, 255));
+            v_plane[cy * cw + cx] = uint8_t(std::clamp((32768 * r - 27439 * g - 5329 * b + 8421376) >> 16, 0, 255));
+        }
+    }
+}
+
+static bool _capture_write_stream(GXCapture* capture, const _capture_frame_t& frame, const std::vector<uint8_t>& data) {
+    auto c = static_cast<_capture_t*>(capture->internal);
+    std::unique_lock<std::mutex> lock(c->write_mutex);
+    c->write_cv.wait(lock, [&] { return c->next_write == frame.sequence; });
+
+    bool ok = false;
+    if (!c->stream_width) {
+        c->stream_width = frame.width;
+        c->stream_height = frame.height;
+        if (capture->options.format == GX_CAPTURE_Y4M) {
+            fprintf(c->stream, "YUV4MPEG2 W%d H%d F%u:1 Ip A1:1 C420jpeg XCOLORRANGE=FULL\n", frame.width, frame.height, capture->options.fps ? capture->options.fps : 60);
+        }
+    }
+    if (frame.width == c->stream_width && frame.height == c->stream_height && !data.empty()) {
+        if (capture->options.format == GX_CAPTURE_Y4M) fputs("FRAME\n", c->stream);
+        ok = fwrite(data.data(), 1, data.size(), c->stream) == data.size();
+    }
+
+    c->next_write++;
+    c->write_cv.notify_all();
+    return ok;
+}
+
+static bool _capture_encode(GXCapture* capture, _capture_frame_t& frame) {
+    auto c = static_cast<_capture_t*>(capture->internal);
+    switch (capture->options.format) {
+    case GX_CAPTURE_PNG_SEQUENCE: {
+        char filename[4096];
+        snprintf(filename, sizeof(filename), c->path.c_str(), (unsigned long long)frame.sequence);
+        return stbi_write_png(filename, frame.width, frame.height, 4, frame.pixels.data(), frame.width * 4) != 0;
+    }
+    case GX_CAPTURE_Y4M: {
+        std::vector<uint8_t> yuv;
+        _capture_rgba_to_yuv420(frame, yuv);
+        return _capture_write_stream(capture, frame, yuv);
+    }
+    default:
+        return _capture_write_stream(capture, frame, frame.pixels);
+    }
+}
+
+static void _capture_worker_main(GXCapture* capture) {
+    auto c = static_cast<_capture_t*>(capture->internal);
+    std::unique_lock<std::mutex> lock(c->mutex);
+    for (;;) {
+        c->queue_cv.wait(lock, [&] { return c->stop || !c->queue.empty(); });
+        if (c->queue.empty()) return;
+
+        _capture_frame_t frame = std::move(c->queue.front());
+        c->queue.pop_front();
+        c->busy++;
+        c->space_cv.notify_one();
+        lock.unlock();
+
+        auto start = std::chrono::steady_clock::now();
+        bool ok = _capture_encode(capture, frame);
+        auto end = std::chrono::steady_clock::now();
+
+        lock.lock();
+        c->busy--;
+        if (ok) {
+            if (!c->written) c->first_write = end;
+            c->written++;
+            c->encode_ms += std::chrono::duration<double, std::milli>(end - start).count();
+            c->recent_writes.push_back(end);
+            while (end - c->recent_writes.front() > std::chrono::seconds(1)) c->recent_writes.pop_front();
+        } else {
+            c->failed++;
+        }
+        c->idle_cv.notify_all();
+    }
+}
+
+static bool _capture_enqueue(GXCapture* capture, _capture_frame_t&& frame) {
+    auto c = static_cast<_capture_t*>(capture->internal);
+    std::unique_lock<std::mutex> lock(c->mutex);
+    if (c->queue.size() >= c->capacity) {
+        if (capture->options.backpressure == GX_CAPTURE_BACKPRESSURE_DROP) {
+            c->dropped++;
+            return false;
+        }
+        c->space_cv.wait(lock, [&] { return c->queue.size() < c->capacity; });
+    }
+    frame.sequence = c->next_sequence++;
+    c->queue.push_back(std::move(frame));
+    c->queue_cv.notify_one();
+    return true;
+}
+
+// Hands completed readbacks to the workers in order, waiting for the oldest `wait_count` of them
+static void _capture_collect(GXCapture* capture, size_t wait_count) {
+    auto c = static_cast<_capture_t*>(capture->internal);
+    while (!c->readbacks.empty()) {
+        uint64_t ticket = c->readbacks.front();
+        GXReadbackResult result;
+        if (!gxMapReadback(&c->ring, ticket, wait_count > 0, &result)) {
+            if (wait_count == 0) break;
+            // Not mappable even when waiting, the read is lost
+            c->readbacks.pop_front();
+            std::lock_guard<std::mutex> lock(c->mutex);
+            c->failed++;
+            continue;
+        }
+
+        _capture_frame_t frame = { 0, result.width, result.height, std::vector<uint8_t>(result.size) };
+        const uint8_t* src = static_cast<const uint8_t*>(result.data);
+        for (int row = 0; row < result.height; row++) {
+            memcpy(frame.pixels.data() + row * result.row_pitch, src + (result.height - 1 - row) * result.row_pitch, result.row_pitch);
+        }
+        gxUnmapReadback(&c->ring, ticket);
+        c->readbacks.pop_front();
+        if (wait_count) wait_count--;
+        _capture_enqueue(capture, std::move(frame));
+    }
+}
+
+static void _capture_release(GXCapture* capture) {
+    auto c = static_cast<_capture_t*>(capture->internal);
+    gxCaptureFlush(capture);
+    {
+        std::lock_guard<std::mutex> lock(c->mutex);
+        c->stop = true;
+    }
+    c->queue_cv.notify_all();
+    for (auto& worker : c->workers) worker.join();
+
+    if (c->stream) {
+#if defined(_WIN32)
+        c->pipe ? _pclose(c->stream) : fclose(c->stream);
+#else
+        c->pipe ? pclose(c->stream) : fclose(c->stream);
+#endif
+    }
+    _readback_ring_release(&c->ring);
+    delete c;
+}
+
+GXCapture* gxAsCapture(GXResource* res) { return static_cast<GXCapture*>(res->resource); }
+
+GXCapture* gxCreateCapture(const GXCaptureOptions* options) {
+    if (!m_app || !options || !options->path) return nullptr;
+    if (options->format == GX_CAPTURE_PNG_SEQUENCE && !_file_pattern_valid(options->path, "ll", 1)) return nullptr;
+
+    _capture_t* internal = new _capture_t();
+    internal->path = options->path;
+    if (options->format != GX_CAPTURE_PNG_SEQUENCE) {
+        if (internal->path[0] == '|') {
+            internal->pipe = true;
+#if defined(_WIN32)
+            internal->stream = _popen(internal->path.c_str() + 1, "wb");
+#else
+            internal->stream = popen(internal->path.c_str() + 1, "w");
+#endif
+        } else {
+            internal->stream = fopen(internal->path.c_str(), "wb");
+        }
+        if (!internal->stream) {
+            delete internal;
+            return nullptr;
+        }
+    }
+
+    // Three reads in flight let a frame be copied two frames after it was rendered
+    internal->ring = { nullptr, 3, 0, new _readback_ring_t() };
+    static_cast<_readback_ring_t*>(internal->ring.internal)->slots.resize(internal->ring.slot_count);
+    if (options->queue_capacity) internal->capacity = options->queue_capacity;
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_CAPTURE;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXCapture* capture = new GXCapture{ resource, *options, internal };
+    capture->options.path = internal->path.c_str();
+    resource->resource = capture;
+
+    unsigned count = options->worker_count ? options->worker_count : std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+    for (unsigned i = 0; i < count; i++) internal->workers.emplace_back(_capture_worker_main, capture);
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return capture;
+}
+
+bool gxCaptureFrame(GXCapture* capture, uint32_t framebuffer, int x, int y, int width, int height) {
+    if (!capture) return false;
+    auto c = static_cast<_capture_t*>(capture->internal);
+    {
+        std::lock_guard<std::mutex> lock(c->mutex);
+        c->captured++;
+    }
+
+    _capture_collect(capture, 0);
+    if (c->readbacks.size() >= c->ring.slot_count) {
+        if (capture->options.backpressure == GX_CAPTURE_BACKPRESSURE_DROP) {
+            std::lock_guard<std::mutex> lock(c->mutex);
+            c->dropped++;
+            return false;
+        }
+        _capture_collect(capture, 1);
+    }
+
+    uint64_t ticket = gxReadPixelsAsync(&c->ring, framebuffer, x, y, width, height, GX_PIXEL_FORMAT_RGBA8);
+    if (!ticket) {
+        std::lock_guard<std::mutex> lock(c->mutex);
+        c->failed++;
+        return false;
+    }
+    c->readbacks.push_back(ticket);
+    return true;
+}
+
+bool gxCaptureWindow(GXCapture* capture, GXWindow* win) {
+    if (!win) return false;
+    int width = 0, height = 0;
+    glfwGetFramebufferSize(static_cast<GLFWwindow*>(win->internal), &width, &height);
+    return gxCaptureFrame(capture, 0, 0, 0, width, height);
+}
+
+void gxCaptureFlush(GXCapture* capture) {
+    if (!capture) return;
+    auto c = static_cast<_capture_t*>(capture->internal);
+    _capture_collect(capture, c->readbacks.size());
+    std::unique_lock<std::mutex> lock(c->mutex);
+    c->idle_cv.wait(lock, [&] { return c->queue.empty() && c->busy == 0; });
+    if (c->stream) fflush(c->stream);
+}
+
+GXCaptureStats gxGetCaptureStats(GXCapture* capture) {
+    GXCaptureStats stats = {};
+    if (!capture) return stats;
+    auto c = static_cast<_capture_t*>(capture->internal);
+    std::lock_guard<std::mutex> lock(c->mutex);
+    auto now = std::chrono::steady_clock::now();
+    while (!c->recent_writes.empty() && now - c->recent_writes.front() > std::chrono::seconds(1)) c->recent_writes.pop_front();
+
+    stats.captured = c->captured;
+    stats.written = c->written;
+    stats.dropped = c->dropped;
+    stats.failed = c->failed;
+    stats.queued = uint32_t(c->readbacks.size() + c->queue.size() + c->busy);
+    stats.fps = double(c->recent_writes.size());
+    double elapsed = std::chrono::duration<double>(now - c->first_write).count();
+    stats.average_fps = c->written && elapsed > 0.0 ? c->written / elapsed : 0.0;
+    stats.encode_ms = c->written ? c->encode_ms / c->written : 0.0;
+    return stats;
+}
+
+static bool _is_stencil_format(uint32_t format) {
+    return format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8 || format == GL_STENCIL_INDEX8;
+}
+
+// Stencil only formats have their own attachment point, only packed formats go to the combined one
+static uint32_t _depth_attachment(uint32_t format) {
+    if (format == GL_STENCIL_INDEX8) return GL_STENCIL_ATTACHMENT;
+    return _is_stencil_format(format) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+}
+
+static void _render_target_release(GXRenderTarget* target) {
+    uint32_t framebuffers[] = { target->framebuffer, target->resolve_framebuffer };
+    glDeleteFramebuffers(2, framebuffers);
+    glDeleteTextures(4, target->color_textures);
+    glDeleteTextures(1, &target->depth_texture);
+    glDeleteRenderbuffers(4, target->color_buffers);
+    glDeleteRenderbuffers(1, &target->depth_buffer);
+}
+
+static bool _render_target_build(GXRenderTarget* target) {
+    const GXRenderTargetDesc& desc = target->desc;
+    bool multisampled = desc.samples > 1;
+    uint32_t draw_buffers[4] = {};
+
+    glCreateFramebuffers(1, &target->framebuffer);
+    if (multisampled) glCreateFramebuffers(1, &target->resolve_framebuffer);
+    // Single sampled targets draw straight into their textures
+    uint32_t texture_framebuffer = multisampled ? target->resolve_framebuffer : target->framebuffer;
+
+    for (uint32_t i = 0; i < desc.color_count; i++) {
+        glCreateTextures(GL_TEXTURE_2D, 1, &target->color_textures[i]);
+        glTextureStorage2D(target->color_textures[i], 1, desc.color_formats[i], desc.width, desc.height);
+        glTextureParameteri(target->color_textures[i], GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(target->color_textures[i], GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(target->color_textures[i], GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(target->color_textures[i], GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glNamedFramebufferTexture(texture_framebuffer, GL_COLOR_ATTACHMENT0 + i, target->color_textures[i], 0);
+        if (multisampled) {
+            glCreateRenderbuffers(1, &target->color_buffers[i]);
+            glNamedRenderbufferStorageMultisample(target->color_buffers[i], desc.samples, desc.color_formats[i], desc.width, desc.height);
+            glNamedFramebufferRenderbuffer(target->framebuffer, GL_COLOR_ATTACHMENT0 + i, GL_RENDERBUFFER, target->color_buffers[i]);
+        }
+        draw_buffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    }
+
+    if (desc.depth_format) {
+        uint32_t attachment = _depth_attachment(desc.depth_format);
+        glCreateTextures(GL_TEXTURE_2D, 1, &target->depth_texture);
+        glTextureStorage2D(target->depth_texture, 1, desc.depth_format, desc.width, desc.height);
+        glTextureParameteri(target->depth_texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTextureParameteri(target->depth_texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(target->depth_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(target->depth_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glNamedFramebufferTexture(texture_framebuffer, attachment, target->depth_texture, 0);
+        if (multisampled) {
+            glCreateRenderbuffers(1, &target->depth_buffer);
+            glNamedRenderbufferStorageMultisample(target->depth_buffer, desc.samples, desc.depth_format, desc.width, desc.height);
+            glNamedFramebufferRenderbuffer(target->framebuffer, attachment, GL_RENDERBUFFER, target->depth_buffer);
+        }
+    }
+
+    if (desc.color_count) {
+        glNamedFramebufferDrawBuffers(target->framebuffer, desc.color_count, draw_buffers);
+        glNamedFramebufferReadBuffer(target->framebuffer, GL_COLOR_ATTACHMENT0);
+    } else {
+        glNamedFramebufferDrawBuffer(target->framebuffer, GL_NONE);
+        glNamedFramebufferReadBuffer(target->framebuffer, GL_NONE);
+    }
+    if (multisampled) {
+        glNamedFramebufferDrawBuffers(target->resolve_framebuffer, desc.color_count, draw_buffers);
+        glNamedFramebufferReadBuffer(target->resolve_framebuffer, desc.color_count ? GL_COLOR_ATTACHMENT0 : GL_NONE);
+    }
+
+    bool complete = glCheckNamedFramebufferStatus(target->framebuffer, GL_DRAW_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    if (multisampled) complete = complete && glCheckNamedFramebufferStatus(target->resolve_framebuffer, GL_DRAW_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    return complete;
+}
+
+// Unused attachment slots are zeroed so descriptions compare bytewise
+static bool _render_target_desc_normalize(const GXRenderTargetDesc* desc, GXRenderTargetDesc& out) {
+    if (!desc || desc->width <= 0 || desc->height <= 0 || desc->color_count > 4) return false;
+    if (!desc->color_count && !desc->depth_format) return false;
+    out = {};
+    out.width = desc->width;
+    out.height = desc->height;
+    out.color_count = desc->color_count;
+    for (uint32_t i = 0; i < desc->color_count; i++) out.color_formats[i] = desc->color_formats[i];
+    out.depth_format = desc->depth_format;
+    out.samples = desc->samples > 1 ? desc->samples : 0;
+    return true;
+}
+
+static GXRenderTarget* _render_target_create(const GXRenderTargetDesc& desc, bool transient) {
+    GXRenderTarget* target = new GXRenderTarget{};
+    target->desc = desc;
+    target->transient = transient;
+    if (!_render_target_build(target)) {
+        _render_target_release(target);
+        delete target;
+        return nullptr;
+    }
+    return target;
+}
+
+GXRenderTarget* gxAsRenderTarget(GXResource* res) { return static_cast<GXRenderTarget*>(res->resource); }
+
+GXRenderTarget* gxCreateRenderTarget(const GXRenderTargetDesc* desc) {
+    GXRenderTargetDesc normalized;
+    if (!m_app || !_render_target_desc_normalize(desc, normalized)) return nullptr;
+    GXRenderTarget* target = _render_target_create(normalized, false);
+    if (!target) return nullptr;
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_RENDER_TARGET;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    resource->resource = target;
+    target->resource = resource;
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return target;
+}
+
+void gxBindRenderTarget(GXRenderTarget* target) {
+    if (target) {
+        glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+        glViewport(0, 0, target->desc.width, target->desc.height);
+        return;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    int width = 0, height = 0;
+    if (GLFWwindow* context = glfwGetCurrentContext()) glfwGetFramebufferSize(context, &width, &height);
+    else if (m_current_window) width = m_current_window->width, height = m_current_window->height;
+    if (width && height) glViewport(0, 0, width, height);
+}
+
+void gxResolveRenderTarget(GXRenderTarget* target) {
+    if (!target || !target->resolve_framebuffer) return;
+    const GXRenderTargetDesc& desc = target->desc;
+    // Blits only copy the read buffer, so every color attachment is resolved on its own
+    for (uint32_t i = 0; i < desc.color_count; i++) {
+        glNamedFramebufferReadBuffer(target->framebuffer, GL_COLOR_ATTACHMENT0 + i);
+        glNamedFramebufferDrawBuffer(target->resolve_framebuffer, GL_COLOR_ATTACHMENT0 + i);
+        glBlitNamedFramebuffer(target->framebuffer, target->resolve_framebuffer, 0, 0, desc.width, desc.height, 0, 0, desc.width, desc.height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+    if (desc.depth_format) {
+        GLbitfield mask = (desc.depth_format != GL_STENCIL_INDEX8 ? GL_DEPTH_BUFFER_BIT : 0) | (_is_stencil_format(desc.depth_format) ? GL_STENCIL_BUFFER_BIT : 0);
+        glBlitNamedFramebuffer(target->framebuffer, target->resolve_framebuffer, 0, 0, desc.width, desc.height, 0, 0, desc.width, desc.height, mask, GL_NEAREST);
+    }
+    if (desc.color_count) {
+        uint32_t draw_buffers[4] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
+        glNamedFramebufferReadBuffer(target->framebuffer, GL_COLOR_ATTACHMENT0);
+        glNamedFramebufferDrawBuffers(target->resolve_framebuffer, desc.color_count, draw_buffers);
+    }
+}
+
+struct _transient_target_t {
+    GXRenderTarget* target;
+    bool in_use;
+    uint64_t last_used;  // Pool frame of the last release
+};
+
+struct _render_target_pool_t {
+    std::vector<_transient_target_t> entries;
+    uint64_t frame = 0;  // Collections of the context, gxExec frames or gxRenderServe jobs
+};
+
+// Unused pooled targets older than this many frames of their window are deleted
+static const uint64_t _transient_target_max_idle_frames = 8;
+static std::unordered_map<void*, _render_target_pool_t> m_render_target_pool; // Keyed by context
+
+// The framebuffers and textures of a destroyed context are gone with it
+static void _render_target_pool_forget(void* context) {
+    auto pool = m_render_target_pool.find(context);
+    if (pool == m_render_target_pool.end()) return;
+    for (auto& entry : pool->second.entries) delete entry.target;
+    m_render_target_pool.erase(pool);
+}
+
+static void _render_target_pool_trim(void* context, uint64_t max_idle_frames) {
+    auto pool = m_render_target_pool.find(context);
+    if (pool == m_render_target_pool.end()) return;
+    auto& entries = pool->second.entries;
+    for (size_t i = 0; i < entries.size();) {
+        if (!entries[i].in_use && pool->second.frame - entries[i].last_used >= max_idle_frames) {
+            _render_target_release(entries[i].target);
+            delete entries[i].target;
+            _container_unordered_remove(entries, entries.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+// Called by gxExec once `context` is current and by gxRenderServe after every job, each call ends a frame of the pool
+static void _render_target_pool_collect(void* context) {
+    auto pool = m_render_target_pool.find(context);
+    if (pool == m_render_target_pool.end()) return;
+    _render_target_pool_trim(context, _transient_target_max_idle_frames);
+    pool->second.frame++;
+}
+
+GXRenderTarget* gxAcquireTransientRenderTarget(const GXRenderTargetDesc* desc) {
+    GXRenderTargetDesc normalized;
+    if (!_render_target_desc_normalize(desc, normalized)) return nullptr;
+    auto& pool = m_render_target_pool[glfwGetCurrentContext()];
+    for (auto& entry : pool.entries) {
+        if (!entry.in_use && !memcmp(&entry.target->desc, &normalized, sizeof(normalized))) {
+            entry.in_use = true;
+            return entry.target;
+        }
+    }
+
+    GXRenderTarget* target = _render_target_create(normalized, true);
+    if (target) pool.entries.push_back({ target, true, pool.frame });
+    return target;
+}
+
+void gxReleaseTransientRenderTarget(GXRenderTarget* target) {
+    if (!target || !target->transient) return;
+    auto& pool = m_render_target_pool[glfwGetCurrentContext()];
+    for (auto& entry : pool.entries) {
+        if (entry.target == target) {
+            entry.in_use = false;
+            entry.last_used = pool.frame;
+            return;
+        }
+    }
+}
+
+void gxTrimTransientRenderTargets() {
+    _render_target_pool_trim(glfwGetCurrentContext(), 0);
+}
+
+enum _graph_resource_kind_t { _GRAPH_TEXTURE, _GRAPH_BUFFER, _GRAPH_IMPORTED };
+
+struct _graph_resource_t {
+    std::string name;
+    _graph_resource_kind_t kind;
+    GXRenderTargetDesc desc;
+    size_t size;
+    GXRenderTarget* imported;
+    int physical = -1;            // Index into the physical textures or buffers
+    int first = -1, last = -1;    // Positions in the execution order
+};
+
+struct _graph_pass_t {
+    std::string name;
+    GXRenderPassCallback callback;
+    void* user_data;
+    std::vector<uint32_t> reads, writes;  // Resource indices
+    std::vector<uint32_t> producers;      // Passes whose writes this pass reads
+    std::vector<uint32_t> successors;     // Passes that must run after this one
+    uint32_t dependency_count = 0;
+    bool alive = false;
+    GLbitfield barrier_bits = 0;
+    std::vector<uint32_t> resolves;
+};
+
+struct _graph_physical_texture_t { GXRenderTarget* target; int busy_until; bool used; };
+struct _graph_physical_buffer_t { uint32_t buffer; size_t size; int busy_until; bool used; };
+
+struct _render_graph_t {
+    std::vector<_graph_resource_t> resources;
+    std::vector<_graph_pass_t> passes;
+    std::vector<uint32_t> order;
+    bool compiled = false;
+    // Physical resources outlive a frame so identical graphs declared every frame allocate nothing
+    std::vector<_graph_physical_texture_t> textures;
+    std::vector<_graph_physical_buffer_t> buffers;
+};
+
+static void _render_graph_release(GXRenderGraph* graph) {
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    for (auto& texture : g->textures) {
+        _render_target_release(texture.target);
+        delete texture.target;
+    }
+    for (auto& buffer : g->buffers) glDeleteBuffers(1, &buffer.buffer);
+    delete g;
+}
+
+GXRenderGraph* gxAsRenderGraph(GXResource* res) { return static_cast<GXRenderGraph*>(res->resource); }
+
+GXRenderGraph* gxCreateRenderGraph() {
+    if (!m_app) return nullptr;
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_RENDER_GRAPH;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXRenderGraph* graph = new GXRenderGraph{ resource, 0, 0, 0, 0, 0, new _render_graph_t() };
+    resource->resource = graph;
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return graph;
+}
+
+void gxRenderGraphReset(GXRenderGraph* graph) {
+    if (!graph) return;
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    g->resources.clear();
+    g->passes.clear();
+    g->order.clear();
+    g->compiled = false;
+    graph->pass_count = graph->culled_pass_count = graph->barrier_count = graph->virtual_resource_count = 0;
+}
+
+static uint32_t _render_graph_add_resource(GXRenderGraph* graph, _graph_resource_t&& resource) {
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    g->resources.push_back(std::move(resource));
+    g->compiled = false;
+    if (g->resources.back().kind != _GRAPH_IMPORTED) graph->virtual_resource_count++;
+    return (uint32_t)g->resources.size();
+}
+
+uint32_t gxRenderGraphCreateTexture(GXRenderGraph* graph, const GXRenderTargetDesc* desc, const char* name) {
+    GXRenderTargetDesc normalized;
+    if (!graph || !_render_target_desc_normalize(desc, normalized)) return 0;
+    return _render_graph_add_resource(graph, { name ? name : "", _GRAPH_TEXTURE, normalized, 0, nullptr });
+}
+
+uint32_t gxRenderGraphCreateBuffer(GXRenderGraph* graph, size_t size, const char* name) {
+    if (!graph || !size) return 0;
+    return _render_graph_add_resource(graph, { name ? name : "", _GRAPH_BUFFER, {}, size, nullptr });
+}
+
+uint32_t gxRenderGraphImportTarget(GXRenderGraph* graph, GXRenderTarget* target, const char* name) {
+    if (!graph) return 0;
+    GXRenderTargetDesc desc = target ? target->desc : GXRenderTargetDesc{};
+    return _render_graph_add_resource(graph, { name ? name : "", _GRAPH_IMPORTED, desc, 0, target });
+}
+
+uint32_t gxRenderGraphAddPass(GXRenderGraph* graph, const char* name, GXRenderPassCallback callback, void* user_data) {
+    if (!graph || !callback) return 0;
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    _graph_pass_t pass;
+    pass.name = name ? name : "";
+    pass.callback = callback;
+    pass.user_data = user_data;
+    g->passes.push_back(std::move(pass));
+    g->compiled = false;
+    graph->pass_count = (uint32_t)g->passes.size();
+    return graph->pass_count;
+}
+
+static void _render_graph_access(GXRenderGraph* graph, uint32_t pass, uint32_t handle, bool write) {
+    if (!graph) return;
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    if (!pass || pass > g->passes.size() || !handle || handle > g->resources.size()) return;
+    auto& accesses = write ? g->passes[pass - 1].writes : g->passes[pass - 1].reads;
+    if (std::find(accesses.begin(), accesses.end(), handle - 1) == accesses.end()) accesses.push_back(handle - 1);
+    g->compiled = false;
+}
+
+void gxRenderGraphRead(GXRenderGraph* graph, uint32_t pass, uint32_t handle) {
+    _render_graph_access(graph, pass, handle, false);
+}
+
+void gxRenderGraphWrite(GXRenderGraph* graph, uint32_t pass, uint32_t handle) {
+    _render_graph_access(graph, pass, handle, true);
+}
+
+static GLbitfield _render_graph_barrier_bits(_graph_resource_kind_t kind) {
+    if (kind == _GRAPH_BUFFER) {
+        return GL_SHADER_STORAGE_BARRIER_BIT | GL_UNIFORM_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT |
+            GL_ELEMENT_ARRAY_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT;
+    }
+    return GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT;
+}
+
+static void _render_graph_link(_render_graph_t* g, uint32_t from, uint32_t to) {
+    if (from == to) return;
+    auto& successors = g->passes[from].successors;
+    if (std::find(successors.begin(), successors.end(), to) != successors.end()) return;
+    successors.push_back(to);
+    g->passes[to].dependency_count++;
+}
+
+// Transient resources whose lifetimes do not overlap share a physical resource. OpenGL cannot alias memory between
+// different formats, so textures only share render targets of the same description.
+static bool _render_graph_assign(_render_graph_t* g) {
+    for (auto& texture : g->textures) texture = { texture.target, -1, false };
+    for (auto& buffer : g->buffers) buffer = { buffer.buffer, buffer.size, -1, false };
+
+    std::vector<uint32_t> transient;
+    for (uint32_t i = 0; i < g->resources.size(); i++) {
+        g->resources[i].physical = -1;
+        if (g->resources[i].kind != _GRAPH_IMPORTED && g->resources[i].first >= 0) transient.push_back(i);
+    }
+    std::sort(transient.begin(), transient.end(), [&](uint32_t a, uint32_t b) { return g->resources[a].first < g->resources[b].first; });
+
+    for (uint32_t index : transient) {
+        _graph_resource_t& resource = g->resources[index];
+        if (resource.kind == _GRAPH_TEXTURE) {
+            for (size_t p = 0; p < g->textures.size() && resource.physical < 0; p++) {
+                auto& texture = g->textures[p];
+                if (texture.busy_until < resource.first && !memcmp(&texture.target->desc, &resource.desc, sizeof(resource.desc))) resource.physical = (int)p;
+            }
+            if (resource.physical < 0) {
+                GXRenderTarget* target = _render_target_create(resource.desc, false);
+                if (!target) return false;
+                g->textures.push_back({ target, -1, false });
+                resource.physical = (int)g->textures.size() - 1;
+            }
+            g->textures[resource.physical].busy_until = resource.last;
+            g->textures[resource.physical].used = true;
+        } else {
+            // Smallest free buffer that fits
+            for (size_t p = 0; p < g->buffers.size(); p++) {
+                auto& buffer = g->buffers[p];
+                if (buffer.busy_until >= resource.first || buffer.size < resource.size) continue;
+                if (resource.physical < 0 || buffer.size < g->buffers[resource.physical].size) resource.physical = (int)p;
+            }
+            if (resource.physical < 0) {
+                uint32_t buffer = 0;
+                glCreateBuffers(1, &buffer);
+                glNamedBufferData(buffer, resource.size, nullptr, GL_DYNAMIC_COPY);
+                g->buffers.push_back({ buffer, resource.size, -1, false });
+                resource.physical = (int)g->buffers.size() - 1;
+            }
+            g->buffers[resource.physical].busy_until = resource.last;
+            g->buffers[resource.physical].used = true;
+        }
+    }
+
+    // Physical resources the graph no longer needs are freed, indices of the kept ones are remapped
+    std::vector<int> texture_remap(g->textures.size(), -1), buffer_remap(g->buffers.size(), -1);
+    std::vector<_graph_physical_texture_t> textures;
+    std::vector<_graph_physical_buffer_t> buffers;
+    for (size_t p = 0; p < g->textures.size(); p++) {
+        if (g->textures[p].used) {
+            texture_remap[p] = (int)textures.size();
+            textures.push_back(g->textures[p]);
+        } else {
+            _render_target_release(g->textures[p].target);
+            delete g->textures[p].target;
+        }
+    }
+    for (size_t p = 0; p < g->buffers.size(); p++) {
+        if (g->buffers[p].used) {
+            buffer_remap[p] = (int)buffers.size();
+            buffers.push_back(g->buffers[p]);
+        } else {
+            glDeleteBuffers(1, &g->buffers[p].buffer);
+        }
+    }
+    for (auto& resource : g->resources) {
+        if (resource.physical < 0) continue;
+        resource.physical = resource.kind == _GRAPH_TEXTURE ? texture_remap[resource.physical] : buffer_remap[resource.physical];
+    }
+    g->textures = std::move(textures);
+    g->buffers = std::move(buffers);
+    return true;
+}
+
+bool gxRenderGraphCompile(GXRenderGraph* graph) {
+    if (!graph) return false;
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    const uint32_t pass_count = (uint32_t)g->passes.size();
+    for (auto& pass : g->passes) {
+        pass.producers.clear();
+        pass.successors.clear();
+        pass.dependency_count = 0;
+        pass.alive = false;
+        pass.barrier_bits = 0;
+        pass.resolves.clear();
+    }
+
+    // Dependencies follow declaration order per resource: reads after the last write, writes after earlier reads and writes
+    std::vector<int> last_writer(g->resources.size(), -1);
+    std::vector<std::vector<uint32_t>> readers(g->resources.size());
+    for (uint32_t p = 0; p < pass_count; p++) {
+        _graph_pass_t& pass = g->passes[p];
+        for (uint32_t r : pass.reads) {
+            if (last_writer[r] >= 0 && last_writer[r] != (int)p) {
+                _render_graph_link(g, last_writer[r], p);
+                pass.producers.push_back(last_writer[r]);
+            }
+            readers[r].push_back(p);
+        }
+        for (uint32_t r : pass.writes) {
+            for (uint32_t reader : readers[r]) _render_graph_link(g, reader, p);
+            if (last_writer[r] >= 0) _render_graph_link(g, last_writer[r], p);
+            last_writer[r] = p;
+            readers[r].clear();
+        }
+    }
+
+    // Passes are kept when their writes reach an imported resource
+    std::vector<uint32_t> stack;
+    for (uint32_t p = 0; p < pass_count; p++) {
+        for (uint32_t r : g->passes[p].writes) {
+            if (g->resources[r].kind == _GRAPH_IMPORTED && !g->passes[p].alive) {
+                g->passes[p].alive = true;
+                stack.push_back(p);
+            }
+        }
+    }
+    while (!stack.empty()) {
+        uint32_t p = stack.back();
+        stack.pop_back();
+        for (uint32_t producer : g->passes[p].producers) {
+            if (!g->passes[producer].alive) {
+                g->passes[producer].alive = true;
+                stack.push_back(producer);
+            }
+        }
+    }
+
+    // Kahn's algorithm over every pass, culled passes are skipped once ordered; ties keep declaration order
+    g->order.clear();
+    std::vector<uint32_t> dependencies(pass_count);
+    std::vector<uint32_t> ready;
+    for (uint32_t p = 0; p < pass_count; p++) {
+        dependencies[p] = g->passes[p].dependency_count;
+        if (!dependencies[p]) ready.push_back(p);
+    }
+    size_t ordered = 0;
+    while (!ready.empty()) {
+        auto lowest = std::min_element(ready.begin(), ready.end());
+        uint32_t p = *lowest;
+        ready.erase(lowest);
+        ordered++;
+        if (g->passes[p].alive) g->order.push_back(p);
+        for (uint32_t successor : g->passes[p].successors) {
+            if (!--dependencies[successor]) ready.push_back(successor);
+        }
+    }
+    if (ordered != pass_count) return false;
+
+    for (auto& resource : g->resources) resource.first = resource.last = -1;
+    for (int position = 0; position < (int)g->order.size(); position++) {
+        const _graph_pass_t& pass = g->passes[g->order[position]];
+        for (const auto* accesses : { &pass.reads, &pass.writes }) {
+            for (uint32_t r : *accesses) {
+                if (g->resources[r].first < 0) g->resources[r].first = position;
+                g->resources[r].last = position;
+            }
+        }
+    }
+
+    // A barrier makes every earlier write of its kinds visible, so one per pass at most
+    graph->barrier_count = 0;
+    std::vector<bool> dirty(g->resources.size(), false), unresolved(g->resources.size(), false);
+    for (uint32_t p : g->order) {
+        _graph_pass_t& pass = g->passes[p];
+        for (uint32_t r : pass.reads) {
+            if (dirty[r]) pass.barrier_bits |= _render_graph_barrier_bits(g->resources[r].kind);
+            if (unresolved[r] && g->resources[r].kind != _GRAPH_BUFFER && g->resources[r].desc.samples > 1) pass.resolves.push_back(r);
+            unresolved[r] = false;
+        }
+        if (pass.barrier_bits) {
+            graph->barrier_count++;
+            for (size_t r = 0; r < g->resources.size(); r++) {
+                if (_render_graph_barrier_bits(g->resources[r].kind) & pass.barrier_bits) dirty[r] = false;
+            }
+        }
+        for (uint32_t r : pass.writes) dirty[r] = unresolved[r] = true;
+    }
+
+    graph->culled_pass_count = pass_count - (uint32_t)g->order.size();
+    if (!_render_graph_assign(g)) return false;
+    graph->physical_resource_count = uint32_t(g->textures.size() + g->buffers.size());
+    g->compiled = true;
+    return true;
+}
+
+GXRenderTarget* gxRenderGraphGetTarget(GXRenderGraph* graph, uint32_t handle) {
+    if (!graph) return nullptr;
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    if (!handle || handle > g->resources.size()) return nullptr;
+    const _graph_resource_t& resource = g->resources[handle - 1];
+    if (resource.kind == _GRAPH_IMPORTED) return resource.imported;
+    if (resource.kind != _GRAPH_TEXTURE || resource.physical < 0) return nullptr;
+    return g->textures[resource.physical].target;
+}
+
+uint32_t gxRenderGraphGetBuffer(GXRenderGraph* graph, uint32_t handle) {
+    if (!graph) return 0;
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    if (!handle || handle > g->resources.size()) return 0;
+    const _graph_resource_t& resource = g->resources[handle - 1];
+    if (resource.kind != _GRAPH_BUFFER || resource.physical < 0) return 0;
+    return g->buffers[resource.physical].buffer;
+}
+
+void gxRenderGraphExecute(GXRenderGraph* graph) {
+    if (!graph) return;
+    auto g = static_cast<_render_graph_t*>(graph->internal);
+    if (!g->compiled && !gxRenderGraphCompile(graph)) return;
+
+    for (uint32_t p : g->order) {
+        const _graph_pass_t& pass = g->passes[p];
+        if (pass.barrier_bits) glMemoryBarrier(pass.barrier_bits);
+        for (uint32_t r : pass.resolves) gxResolveRenderTarget(gxRenderGraphGetTarget(graph, r + 1));
+        for (uint32_t r : pass.writes) {
+            if (g->resources[r].kind == _GRAPH_BUFFER) continue;
+            gxBindRenderTarget(gxRenderGraphGetTarget(graph, r + 1));
+            break;
+        }
+        GX_GPU_SCOPE_BEGIN(pass.name.c_str());
+        pass.callback(graph, p + 1, pass.user_data);
+        GX_GPU_SCOPE_END();
+    }
+}
+
+struct _dynamic_resolution_t {
+    uint32_t queries[4] = {};
+    std::deque<uint32_t> pending;   // Queries waiting for their result, oldest first
+    uint32_t next_query = 0;
+    bool timing = false;
+    double error = 0.0, previous_error = 0.0;
+    double filtered_ms = -1.0;
+    int window_width = 0, window_height = 0;
+};
+
+static void _dynamic_resolution_release(GXDynamicResolution* resolution) {
+    auto internal = static_cast<_dynamic_resolution_t*>(resolution->internal);
+    if (internal->queries[0]) glDeleteQueries(4, internal->queries);
+    if (resolution->target) {
+        _render_target_release(resolution->target);
+        delete resolution->target;
+    }
+    delete internal;
+}
+
+GXDynamicResolution* gxAsDynamicResolution(GXResource* res) { return static_cast<GXDynamicResolution*>(res->resource); }
+
+GXDynamicResolution* gxCreateDynamicResolution(const GXDynamicResolutionOptions* options) {
+    if (!m_app || !options || options->target_ms <= 0.0) return nullptr;
+    GXDynamicResolutionOptions resolved = *options;
+    if (resolved.min_scale <= 0.0f) resolved.min_scale = 0.5f;
+    if (resolved.max_scale <= 0.0f) resolved.max_scale = 1.0f;
+    if (resolved.min_scale > resolved.max_scale) return nullptr;
+    if (resolved.kp == 0.0f && resolved.ki == 0.0f && resolved.kd == 0.0f) {
+        resolved.kp = 0.2f;
+        resolved.ki = 0.1f;
+        resolved.kd = 0.02f;
+    }
+    if (!resolved.desc.color_count && !resolved.desc.depth_format) {
+        resolved.desc.color_formats[0] = GL_RGBA8;
+        resolved.desc.color_count = 1;
+        resolved.desc.depth_format = GL_DEPTH24_STENCIL8;
+    }
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_DYNAMIC_RESOLUTION;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXDynamicResolution* resolution = new GXDynamicResolution{ resource, resolved, resolved.max_scale, 0.0, 0, 0, nullptr, new _dynamic_resolution_t() };
+    resource->resource = resolution;
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return resolution;
+}
+
+// Incremental PID on the relative error, GPU time follows the pixel count so the scale moves by its square root
+static void _dynamic_resolution_update(GXDynamicResolution* resolution, double gpu_ms) {
+    auto internal = static_cast<_dynamic_resolution_t*>(resolution->internal);
+    const GXDynamicResolutionOptions& options = resolution->options;
+    // Single frames are noisy (driver work lands in whichever query is open), the controller follows a moving average
+    gpu_ms = std::min(gpu_ms, options.target_ms * 4.0);
+    internal->filtered_ms = internal->filtered_ms < 0.0 ? gpu_ms : internal->filtered_ms + 0.3 * (gpu_ms - internal->filtered_ms);
+    double error = std::clamp((options.target_ms - internal->filtered_ms) / options.target_ms, -1.0, 1.0);
+    double delta = options.kp * (error - internal->error) + options.ki * error + options.kd * (error - 2.0 * internal->error + internal->previous_error);
+    internal->previous_error = internal->error;
+    internal->error = error;
+
+    double area = std::max(0.0, double(resolution->scale) * resolution->scale * (1.0 + delta));
+    resolution->scale = std::clamp(float(std::sqrt(area)), options.min_scale, options.max_scale);
+    resolution->gpu_ms = gpu_ms;
+}
+
+GXRenderTarget* gxDynamicResolutionBegin(GXDynamicResolution* resolution, GXWindow* win) {
+    if (!resolution || !win || win->width <= 0 || win->height <= 0) return nullptr;
+    auto internal = static_cast<_dynamic_resolution_t*>(resolution->internal);
+    if (!internal->queries[0]) glGenQueries(4, internal->queries);
+
+    while (!internal->pending.empty()) {
+        uint32_t query = internal->queries[internal->pending.front()];
+        int available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+        internal->pending.pop_front();
+        _dynamic_resolution_update(resolution, elapsed / 1e6);
+    }
+
+    // Sized for the largest scale, so scale changes never reallocate
+    if (!resolution->target || internal->window_width != win->width || internal->window_height != win->height) {
+        if (resolution->target) {
+            _render_target_release(resolution->target);
+            delete resolution->target;
+        }
+        GXRenderTargetDesc desc = resolution->options.desc;
+        desc.width = std::max(1, (int)std::ceil(win->width * resolution->options.max_scale));
+        desc.height = std::max(1, (int)std::ceil(win->height * resolution->options.max_scale));
+        GXRenderTargetDesc normalized;
+        resolution->target = _render_target_desc_normalize(&desc, normalized) ? _render_target_create(normalized, false) : nullptr;
+        internal->window_width = win->width;
+        internal->window_height = win->height;
+        if (!resolution->target) return nullptr;
+    }
+
+    resolution->width = std::clamp((int)std::lround(win->width * resolution->scale), 1, resolution->target->desc.width);
+    resolution->height = std::clamp((int)std::lround(win->height * resolution->scale), 1, resolution->target->desc.height);
+    glBindFramebuffer(GL_FRAMEBUFFER, resolution->target->framebuffer);
+    glViewport(0, 0, resolution->width, resolution->height);
+
+    // Every query is in flight when the GPU is 4 frames behind, that frame is not timed
+    internal->timing = internal->pending.size() < 4;
+    if (internal->timing) glBeginQuery(GL_TIME_ELAPSED, internal->queries[internal->next_query]);
+    return resolution->target;
+}
+
+void gxDynamicResolutionEnd(GXDynamicResolution* resolution, GXWindow* win) {
+    if (!resolution || !win || !resolution->target) return;
+    auto internal = static_cast<_dynamic_resolution_t*>(resolution->internal);
+    if (internal->timing) {
+        glEndQuery(GL_TIME_ELAPSED);
+        internal->pending.push_back(internal->next_query);
+        internal->next_query = (internal->next_query + 1) % 4;
+        internal->timing = false;
+    }
+
+    GXRenderTarget* target = resolution->target;
+    uint32_t source = target->framebuffer;
+    if (target->resolve_framebuffer) {
+        gxResolveRenderTarget(target);
+        source = target->resolve_framebuffer;
+    }
+    if (target->desc.color_count) {
+        glBlitNamedFramebuffer(source, 0, 0, 0, resolution->width, resolution->height, 0, 0, win->width, win->height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    gxUpdateViewport(win);
+}
+
+struct _tiled_render_t {
+    const GXTiledRenderOptions* options;
+    GXTileDrawCallback draw;
+    void* user_data;
+    int columns, rows;
+    GXRenderTargetDesc desc;       // Tile target, sized for the largest tile
+    GXPixelFormat pixel_format;
+    uint32_t pixel_size;
+    FILE* file = nullptr;
+    uint64_t header_size = 0;
+    std::mutex mutex;
+    int next_tile = 0;
+    bool failed = false;
+};
+
+static bool _file_seek(FILE* file, uint64_t offset) {
+#if defined(_WIN32)
+    return _fseeki64(file, (long long)offset, SEEK_SET) == 0;
+#else
+    return fseeko(file, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+static void _tiled_render_tile(const _tiled_render_t& state, int index, GXTile& tile) {
+    const GXTiledRenderOptions& options = *state.options;
+    tile.column = index % state.columns;
+    tile.row = index / state.columns;
+    tile.x = tile.column * state.desc.width;
+    tile.y = tile.row * state.desc.height;
+    tile.width = std::min(state.desc.width, options.width - tile.x);
+    tile.height = std::min(state.desc.height, options.height - tile.y);
+
+    // Clip space crop of the tile: its NDC rectangle is scaled to [-1, 1], rows count from the top of the image
+    double left = 2.0 * tile.x / options.width - 1.0;
+    double right = 2.0 * (tile.x + tile.width) / options.width - 1.0;
+    double bottom = 2.0 * (options.height - tile.y - tile.height) / options.height - 1.0;
+    double top = 2.0 * (options.height - tile.y) / options.height - 1.0;
+    double sx = 2.0 / (right - left), sy = 2.0 / (top - bottom);
+    memset(tile.projection, 0, sizeof(tile.projection));
+    tile.projection[0] = float(sx);
+    tile.projection[5] = float(sy);
+    tile.projection[10] = 1.0f;
+    tile.projection[12] = float(-sx * (left + right) * 0.5);
+    tile.projection[13] = float(-sy * (bottom + top) * 0.5);
+    tile.projection[15] = 1.0f;
+}
+
+// Readback rows are bottom to top, files are written top to bottom
+static bool _tiled_render_write(_tiled_render_t& state, const GXTile& tile, const GXReadbackResult& result) {
+    const uint8_t* pixels = static_cast<const uint8_t*>(result.data);
+    if (state.options->format == GX_TILED_OUTPUT_PNG_TILES) {
+        char filename[4096];
+        snprintf(filename, sizeof(filename), state.options->path, tile.column, tile.row);
+        const uint8_t* last_row = pixels + (result.height - 1) * result.row_pitch;
+        std::vector<uint8_t> flipped(result.size);
+        for (int row = 0; row < result.height; row++) memcpy(flipped.data() + row * result.row_pitch, last_row - row * result.row_pitch, result.row_pitch);
+        return stbi_write_png(filename, result.width, result.height, 4, flipped.data(), (int)result.row_pitch) != 0;
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (int row = 0; row < result.height; row++) {
+        uint64_t offset = state.header_size + ((uint64_t)(tile.y + row) * state.options->width + tile.x) * state.pixel_size;
+        const uint8_t* source = pixels + (result.height - 1 - row) * result.row_pitch;
+        if (!_file_seek(state.file, offset) || fwrite(source, 1, result.row_pitch, state.file) != result.row_pitch) return false;
+    }
+    return true;
+}
+
+// Runs on every context drawing tiles, tiles are taken from a shared counter
+static void _tiled_render_worker(_tiled_render_t* state, uint32_t context_index) {
+    GXRenderTarget* target = _render_target_create(state->desc, false);
+    if (!target) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->failed = true;
+        return;
+    }
+    uint32_t read_framebuffer = target->resolve_framebuffer ? target->resolve_framebuffer : target->framebuffer;
+
+    // Two pack buffers: drawing a tile overlaps writing the previous one
+    GXReadbackRing ring = { nullptr, 2, 0, new _readback_ring_t() };
+    static_cast<_readback_ring_t*>(ring.internal)->slots.resize(ring.slot_count);
+    std::deque<std::pair<uint64_t, GXTile>> pending;
+    bool ok = true;
+    auto write_oldest = [&] {
+        GXReadbackResult result;
+        if (gxMapReadback(&ring, pending.front().first, true, &result)) {
+            ok = _tiled_render_write(*state, pending.front().second, result) && ok;
+            gxUnmapReadback(&ring, pending.front().first);
+        } else {
+            ok = false;
+        }
+        pending.pop_front();
+    };
+
+    const int tile_count = state->columns * state->rows;
+    while (ok) {
+        int index;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->failed || state->next_tile >= tile_count) break;
+            index = state->next_tile++;
+        }
+
+        GXTile tile;
+        _tiled_render_tile(*state, index, tile);
+        tile.context_index = context_index;
+        tile.target = target;
+        glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+        glViewport(0, 0, tile.width, tile.height);
+        state->draw(&tile, state->user_data);
+        gxResolveRenderTarget(target);
+
+        if (pending.size() >= ring.slot_count) write_oldest();
+        uint64_t ticket = gxReadPixelsAsync(&ring, read_framebuffer, 0, 0, tile.width, tile.height, state->pixel_format);
+        if (ticket) pending.push_back({ ticket, tile });
+        else ok = false;
+    }
+    while (!pending.empty()) write_oldest();
+
+    _readback_ring_release(&ring);
+    _render_target_release(target);
+    delete target;
+    if (!ok) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->failed = true;
+    }
+}
+
+bool gxRenderTiled(const GXTiledRenderOptions* options, GXTileDrawCallback draw, void* user_data) {
+    if (!options || !draw || !options->path || options->width <= 0 || options->height <= 0) return false;
+    if (options->format == GX_TILED_OUTPUT_PNG_TILES && !_file_pattern_valid(options->path, "", 2)) return false;
+
+    int viewport_dims[2] = {}, renderbuffer_size = 0, texture_size = 0;
+    glGetIntegerv(GL_MAX_VIEWPORT_DIMS, viewport_dims);
+    glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &renderbuffer_size);
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &texture_size);
+    int limit_width = std::min({ viewport_dims[0], renderbuffer_size, texture_size, 4096 });
+    int limit_height = std::min({ viewport_dims[1], renderbuffer_size, texture_size, 4096 });
+    if (limit_width <= 0 || limit_height <= 0) return false;
+
+    _tiled_render_t state;
+    state.options = options;
+    state.draw = draw;
+    state.user_data = user_data;
+    GXRenderTargetDesc desc = options->desc;
+    if (!desc.color_count) {
+        desc.color_formats[0] = GL_RGBA8;
+        desc.color_count = 1;
+        if (!desc.depth_format) desc.depth_format = GL_DEPTH24_STENCIL8;
+    }
+    desc.width = std::min({ options->tile_width > 0 ? options->tile_width : limit_width, limit_width, options->width });
+    desc.height = std::min({ options->tile_height > 0 ? options->tile_height : limit_height, limit_height, options->height });
+    if (!_render_target_desc_normalize(&desc, state.desc)) return false;
+    state.columns = (options->width + state.desc.width - 1) / state.desc.width;
+    state.rows = (options->height + state.desc.height - 1) / state.desc.height;
+    state.pixel_format = options->format == GX_TILED_OUTPUT_PPM ? GX_PIXEL_FORMAT_RGB8 : GX_PIXEL_FORMAT_RGBA8;
+    state.pixel_size = options->format == GX_TILED_OUTPUT_PPM ? 3 : 4;
+
+    if (options->format != GX_TILED_OUTPUT_PNG_TILES) {
+        state.file = fopen(options->path, "wb");
+        if (!state.file) return false;
+        if (options->format == GX_TILED_OUTPUT_PPM) state.header_size = (uint64_t)fprintf(state.file, "P6\n%d %d\n255\n", options->width, options->height);
+        // Sized up front so tiles can be written in place in any order
+        uint64_t size = state.header_size + (uint64_t)options->width * options->height * state.pixel_size;
+        if (!_file_seek(state.file, size - 1) || fputc(0, state.file) == EOF) {
+            fclose(state.file);
+            return false;
+        }
+    }
+
+    int framebuffer = 0, viewport[4] = {};
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    // Worker contexts share objects with the calling one, each draws into its own target
+    std::vector<GLFWwindow*> contexts;
+    std::vector<std::thread> threads;
+    GLFWwindow* share = glfwGetCurrentContext();
+    if (share && options->context_count > 1) {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        for (uint32_t i = 1; i < options->context_count; i++) {
+            GLFWwindow* context = _create_glfw_window(1, 1, "", share);
+            if (!context) break;
+            contexts.push_back(context);
+        }
+        glfwMakeContextCurrent(share);
+        for (size_t i = 0; i < contexts.size(); i++) {
+            threads.emplace_back([&state, context = contexts[i], i] {
+                glfwMakeContextCurrent(context);
+                _tiled_render_worker(&state, uint32_t(i + 1));
+                glFinish();
+                glfwMakeContextCurrent(nullptr);
+            });
+        }
+    }
+    _tiled_render_worker(&state, 0);
+    for (auto& thread : threads) thread.join();
+    for (GLFWwindow* context : contexts) glfwDestroyWindow(context);
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    if (state.file && fclose(state.file) != 0) state.failed = true;
+    return !state.failed;
+}
+
+// Software rasterizer, triangles are binned into tiles so every tile is rasterized by one thread without locking
+
+static constexpr int SOFT_TILE_SIZE = 64;
+// Vertices snap to 1/16 pixel, edge functions are then exact in 64-bit and fit 32-bit inside a tile
+static constexpr int SOFT_SUBPIXEL = 16;
+static constexpr int SOFT_MAX_SIZE = 32768;
+// Triangles queued before a draw rasterizes early
+static constexpr size_t SOFT_MAX_QUEUED_TRIANGLES = 1 << 20;
+static constexpr uint32_t SOFT_VERTEX_CHUNK = 4096;
+static constexpr uint32_t SOFT_TRIANGLE_CHUNK = 2048;
+
+struct _soft_vertex_t {
+    float clip[4];
+    float color[4];
+};
+
+// Edges are planes a * x + b * y + c in subpixels, interpolated values in pixels, rows from the top
+struct _soft_triangle_t {
+    int64_t edge[3][3];         // Not negative inside, edge k is opposite to vertex k, biased by the top-left rule
+    float z[3];
+    float attribute[5][3];      // r/w, g/w, b/w, a/w and 1/w
+    uint32_t color;             // Packed color when not interpolated
+    int min_x, min_y, max_x, max_y;
+    bool interpolate, depth_test, depth_write;
+};
+
+// Pixels [begin, end) of a tile row, offsets are relative to the tile origin
+struct _soft_span_t {
+    uint32_t* color;
+    float* depth;
+    int begin, end;
+    int32_t edge[3], edge_step[3];
+    float z, z_step;
+    float attribute[5], attribute_step[5];
+    uint32_t color_value;
+    bool interpolate, depth_test, depth_write;
+};
+
+typedef void (*_soft_span_fn)(const _soft_span_t& span);
+
+struct _soft_renderer_t {
+    int tiles_x, tiles_y;
+    std::vector<uint32_t> color;
+    std::vector<float> depth;
+    std::vector<_soft_triangle_t> triangles;
+    std::vector<std::vector<uint32_t>> bins;
+    _soft_span_fn span;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake, done;
+    const std::function<void(uint32_t)>* job = nullptr;
+    uint32_t job_count = 0, next_job = 0, running = 0;
+    uint64_t generation = 0;
+    bool stop = false;
+};
+
+static uint32_t _soft_pack(float r, float g, float b, float a) {
+    auto channel = [](float v) { return uint32_t(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f); };
+    return channel(r) | channel(g) << 8 | channel(b) << 16 | channel(a) << 24;
+}
+
+static void _soft_span_scalar(const _soft_span_t& s) {
+    for (int i = s.begin; i < s.end; i++) {
+        if (((s.edge[0] + s.edge_step[0] * i) | (s.edge[1] + s.edge_step[1] * i) | (s.edge[2] + s.edge_step[2] * i)) < 0) continue;
+        float x = float(i);
+        float z = s.z + s.z_step * x;
+        if (s.depth_test && !(z < s.depth[i])) continue;
+        if (s.depth_write) s.depth[i] = z;
+        if (s.interpolate) {
+            float w = 1.0f / (s.attribute[4] + s.attribute_step[4] * x);
+            float c[4];
+            for (int k = 0; k < 4; k++) c[k] = (s.attribute[k] + s.attribute_step[k] * x) * w;
+            s.color[i] = _soft_pack(c[0], c[1], c[2], c[3]);
+        } else {
+            s.color[i] = s.color_value;
+        }
+    }
+}
+
+#if defined(GX_X86)
+#if defined(_MSC_VER)
+#define GX_TARGET(isa)
+#else
+#define GX_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+GX_TARGET("sse4.1") static void _soft_span_sse41(const _soft_span_t& s) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128i lane_index = _mm_setr_epi32(0, 1, 2, 3);
+    for (int i = s.begin & ~3; i < s.end; i += 4) {
+        __m128 x = _mm_add_ps(_mm_set1_ps(float(i)), lanes);
+        __m128i index = _mm_add_epi32(_mm_set1_epi32(i), lane_index);
+        __m128i inside = _mm_and_si128(_mm_cmpgt_epi32(index, _mm_set1_epi32(s.begin - 1)), _mm_cmplt_epi32(index, _mm_set1_epi32(s.end)));
+        __m128i edges = _mm_setzero_si128();
+        for (int k = 0; k < 3; k++) edges = _mm_or_si128(edges, _mm_add_epi32(_mm_set1_epi32(s.edge[k]), _mm_mullo_epi32(_mm_set1_epi32(s.edge_step[k]), index)));
+        __m128 mask = _mm_castsi128_ps(_mm_and_si128(inside, _mm_cmpgt_epi32(edges, _mm_set1_epi32(-1))));
+        if (!_mm_movemask_ps(mask)) continue;
+
+        __m128 z = _mm_add_ps(_mm_set1_ps(s.z), _mm_mul_ps(_mm_set1_ps(s.z_step), x));
+        __m128 depth = _mm_loadu_ps(s.depth + i);
+        if (s.depth_test) mask = _mm_and_ps(mask, _mm_cmplt_ps(z, depth));
+        if (!_mm_movemask_ps(mask)) continue;
+        if (s.depth_write) _mm_storeu_ps(s.depth + i, _mm_blendv_ps(depth, z, mask));
+
+        __m128i color = _mm_set1_epi32(int(s.color_value));
+        if (s.interpolate) {
+            __m128 w = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_set1_ps(s.attribute[4]), _mm_mul_ps(_mm_set1_ps(s.attribute_step[4]), x)));
+            color = _mm_setzero_si128();
+            for (int k = 0; k < 4; k++) {
+                __m128 c = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(s.attribute[k]), _mm_mul_ps(_mm_set1_ps(s.attribute_step[k]), x)), w);
+                c = _mm_min_ps(_mm_max_ps(c, zero), _mm_set1_ps(1.0f));
+                __m128i channel = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(c, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+                color = _mm_or_si128(color, _mm_slli_epi32(channel, 8 * k));
+            }
+        }
+        __m128 old = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s.color + i)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(s.color + i), _mm_castps_si128(_mm_blendv_ps(old, _mm_castsi128_ps(color), mask)));
+    }
+}
+
+GX_TARGET("avx2") static void _soft_span_avx2(const _soft_span_t& s) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 lanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    const __m256i lane_index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    for (int i = s.begin & ~7; i < s.end; i += 8) {
+        __m256 x = _mm256_add_ps(_mm256_set1_ps(float(i)), lanes);
+        __m256i index = _mm256_add_epi32(_mm256_set1_epi32(i), lane_index);
+        __m256i inside = _mm256_and_si256(_mm256_cmpgt_epi32(index, _mm256_set1_epi32(s.begin - 1)), _mm256_cmpgt_epi32(_mm256_set1_epi32(s.end), index));
+        __m256i edges = _mm256_setzero_si256();
+        for (int k = 0; k < 3; k++) edges = _mm256_or_si256(edges, _mm256_add_epi32(_mm256_set1_epi32(s.edge[k]), _mm256_mullo_epi32(_mm256_set1_epi32(s.edge_step[k]), index)));
+        __m256 mask = _mm256_castsi256_ps(_mm256_and_si256(inside, _mm256_cmpgt_epi32(edges, _mm256_set1_epi32(-1))));
+        if (!_mm256_movemask_ps(mask)) continue;
+
+        __m256 z = _mm256_add_ps(_mm256_set1_ps(s.z), _mm256_mul_ps(_mm256_set1_ps(s.z_step), x));
+        __m256 depth = _mm256_loadu_ps(s.depth + i);
+        if (s.depth_test) mask = _mm256_and_ps(mask, _mm256_cmp_ps(z, depth, _CMP_LT_OQ));
+        if (!_mm256_movemask_ps(mask)) continue;
+        if (s.depth_write) _mm256_storeu_ps(s.depth + i, _mm256_blendv_ps(depth, z, mask));
+
+        __m256i color = _mm256_set1_epi32(int(s.color_value));
+        if (s.interpolate) {
+            __m256 w = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_add_ps(_mm256_set1_ps(s.attribute[4]), _mm256_mul_ps(_mm256_set1_ps(s.attribute_step[4]), x)));
+            color = _mm256_setzero_si256();
+            for (int k = 0; k < 4; k++) {
+                __m256 c = _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps(s.attribute[k]), _mm256_mul_ps(_mm256_set1_ps(s.attribute_step[k]), x)), w);
+                c = _mm256_min_ps(_mm256_max_ps(c, zero), _mm256_set1_ps(1.0f));
+                __m256i channel = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(c, _mm256_set1_ps(255.0f)), _mm256_set1_ps(0.5f)));
+                color = _mm256_or_si256(color, _mm256_sllv_epi32(channel, _mm256_set1_epi32(8 * k)));
+            }
+        }
+        __m256 old = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(s.color + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(s.color + i), _mm256_castps_si256(_mm256_blendv_ps(old, _mm256_castsi256_ps(color), mask)));
+    }
+}
+#endif
+
+static GXSoftwareISA _soft_supported_isa() {
+#if defined(GX_X86)
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool sse41 = info[2] & (1 << 19);
+    bool avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+    __cpuidex(info, 7, 0);
+    if (avx && (info[1] & (1 << 5))) return GX_SOFTWARE_ISA_AVX2;
+    if (sse41) return GX_SOFTWARE_ISA_SSE41;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return GX_SOFTWARE_ISA_AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return GX_SOFTWARE_ISA_SSE41;
+#endif
+#endif
+    return GX_SOFTWARE_ISA_SCALAR;
+}
+
+static void _soft_run_jobs(_soft_renderer_t* r, std::unique_lock<std::mutex>& lock) {
+    while (r->next_job < r->job_count) {
+        uint32_t index = r->next_job++;
+        lock.unlock();
+        (*r->job)(index);
+        lock.lock();
+    }
+}
+
+static void _soft_worker_main(_soft_renderer_t* r) {
+    uint64_t generation = 0;
+    std::unique_lock<std::mutex> lock(r->mutex);
+    for (;;) {
+        r->wake.wait(lock, [&] { return r->stop || r->generation != generation; });
+        if (r->stop) return;
+        generation = r->generation;
+        r->running++;
+        _soft_run_jobs(r, lock);
+        if (--r->running == 0) r->done.notify_all();
+    }
+}
+
+// Runs job(0) to job(count - 1) on the workers and the calling thread
+static void _soft_parallel(_soft_renderer_t* r, uint32_t count, const std::function<void(uint32_t)>& job) {
+    if (r->workers.empty() || count <= 1) {
+        for (uint32_t i = 0; i < count; i++) job(i);
+        return;
+    }
+    std::unique_lock<std::mutex> lock(r->mutex);
+    r->job = &job;
+    r->job_count = count;
+    r->next_job = 0;
+    r->generation++;
+    r->wake.notify_all();
+    _soft_run_jobs(r, lock);
+    r->done.wait(lock, [&] { return r->running == 0; });
+    r->job = nullptr;
+    r->job_count = 0;
+}
+
+static bool _soft_fetch(const uint8_t* vertex, const GXVertexAttribute* attribute, float* out) {
+    const uint8_t* data = vertex + attribute->offset;
+    for (int i = 0; i < attribute->size; i++) {
+        switch (attribute->type) {
+        case GX_VERTEX_ATTRIB_TYPE_FLOAT: { float v; memcpy(&v, data + i * 4, 4); out[i] = v; break; }
+        case GX_VERTEX_ATTRIB_TYPE_BYTE: { int8_t v = int8_t(data[i]); out[i] = attribute->normalized ? std::max(v / 127.0f, -1.0f) : v; break; }
+        case GX_VERTEX_ATTRIB_TYPE_UNSIGNED_BYTE: out[i] = attribute->normalized ? data[i] / 255.0f : data[i]; break;
+        case GX_VERTEX_ATTRIB_TYPE_SHORT: { int16_t v; memcpy(&v, data + i * 2, 2); out[i] = attribute->normalized ? std::max(v / 32767.0f, -1.0f) : v; break; }
+        case GX_VERTEX_ATTRIB_TYPE_UNSIGNED_SHORT: { uint16_t v; memcpy(&v, data + i * 2, 2); out[i] = attribute->normalized ? v / 65535.0f : v; break; }
+        case GX_VERTEX_ATTRIB_TYPE_INT: { int32_t v; memcpy(&v, data + i * 4, 4); out[i] = attribute->normalized ? std::max(float(v / 2147483647.0), -1.0f) : float(v); break; }
+        case GX_VERTEX_ATTRIB_TYPE_UNSIGNED_INT: { uint32_t v; memcpy(&v, data + i * 4, 4); out[i] = attribute->normalized ? float(v / 4294967295.0) : float(v); break; }
+        default: return false;
+        }
+    }
+    return true;
+}
+
+static void _soft_transform(const float* m, const float* v, float w, float* out) {
+    for (int i = 0; i < 4; i++) out[i] = m[i] * v[0] + m[4 + i] * v[1] + m[8 + i] * v[2] + m[12 + i] * w;
+}
+
+// Diffuse light of a normal already in the lighting space
+static void _soft_light(const GXSoftwareDraw* draw, const float* normal, const float* light, const float* base, float* out) {
+    float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    float diffuse = length > 0.0f ? std::max((normal[0] * light[0] + normal[1] * light[1] + normal[2] * light[2]) / length, 0.0f) : 0.0f;
+    float ambient = std::clamp(draw->ambient, 0.0f, 1.0f);
+    float intensity = ambient + (1.0f - ambient) * diffuse;
+    for (int i = 0; i < 3; i++) out[i] = base[i] * intensity;
+    out[3] = base[3];
+}
+
+// Sutherland-Hodgman against the 6 clip planes, returns the polygon vertex count
+static int _soft_clip(_soft_vertex_t* polygon, int count) {
+    _soft_vertex_t scratch[9];
+    _soft_vertex_t* in = polygon;
+    _soft_vertex_t* out = scratch;
+    for (int plane = 0; plane < 6 && count; plane++) {
+        int axis = plane / 2;
+        float sign = plane & 1 ? -1.0f : 1.0f;
+        auto distance = [&](const _soft_vertex_t& v) { return v.clip[3] + sign * v.clip[axis]; };
+        int out_count = 0;
+        for (int i = 0; i < count; i++) {
+            const _soft_vertex_t& a = in[i];
+            const _soft_vertex_t& b = in[(i + 1) % count];
+            float da = distance(a), db = distance(b);
+            if (da >= 0.0f) out[out_count++] = a;
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                float t = da / (da - db);
+                _soft_vertex_t& v = out[out_count++];
+                for (int k = 0; k < 4; k++) v.clip[k] = a.clip[k] + (b.clip[k] - a.clip[k]) * t;
+                for (int k = 0; k < 4; k++) v.color[k] = a.color[k] + (b.color[k] - a.color[k]) * t;
+            }
+        }
+        count = out_count;
+        std::swap(in, out);
+    }
+    if (in != polygon) std::copy(in, in + count, polygon);
+    return count;
+}
+
+// Projects a clipped triangle to subpixels, returns false when it covers no pixel center or faces away
+static bool _soft_setup(const GXSoftwareRenderer* renderer, const GXSoftwareDraw* draw, const _soft_vertex_t* const* v,
+                        bool interpolate, uint32_t color, _soft_triangle_t& t) {
+    int64_t x[3], y[3];
+    double z[3], q[5][3];
+    for (int i = 0; i < 3; i++) {
+        double w = 1.0 / v[i]->clip[3];
+        x[i] = int64_t(std::floor((v[i]->clip[0] * w * 0.5 + 0.5) * renderer->options.width * SOFT_SUBPIXEL + 0.5));
+        y[i] = int64_t(std::floor((0.5 - v[i]->clip[1] * w * 0.5) * renderer->options.height * SOFT_SUBPIXEL + 0.5));
+        z[i] = v[i]->clip[2] * w * 0.5 + 0.5;
+        for (int k = 0; k < 4; k++) q[k][i] = v[i]->color[k] * w;
+        q[4][i] = w;
+    }
+
+    // Counter-clockwise triangles in clip space are clockwise with rows from the top
+    int64_t area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if (area == 0 || (draw->cull_back_faces && area > 0)) return false;
+    int order[3] = { 0, 1, 2 };
+    if (area < 0) {
+        std::swap(order[1], order[2]);
+        area = -area;
+    }
+
+    // Pixel centers are half a pixel in
+    auto first_pixel = [](int64_t v) { return int(std::ceil(double(v - SOFT_SUBPIXEL / 2) / SOFT_SUBPIXEL)); };
+    auto last_pixel = [](int64_t v) { return int(std::floor(double(v - SOFT_SUBPIXEL / 2) / SOFT_SUBPIXEL)); };
+    t.min_x = std::max(first_pixel(std::min({ x[0], x[1], x[2] })), 0);
+    t.min_y = std::max(first_pixel(std::min({ y[0], y[1], y[2] })), 0);
+    t.max_x = std::min(last_pixel(std::max({ x[0], x[1], x[2] })), renderer->options.width - 1);
+    t.max_y = std::min(last_pixel(std::max({ y[0], y[1], y[2] })), renderer->options.height - 1);
+    if (t.min_x > t.max_x || t.min_y > t.max_y) return false;
+
+    double edge[3][3];
+    for (int k = 0; k < 3; k++) {
+        int p = order[(k + 1) % 3], n = order[(k + 2) % 3];
+        t.edge[k][0] = y[p] - y[n];
+        t.edge[k][1] = x[n] - x[p];
+        t.edge[k][2] = x[p] * y[n] - x[n] * y[p];
+        for (int c = 0; c < 3; c++) edge[k][c] = double(t.edge[k][c]);
+        // Pixel centers exactly on an edge only belong to the triangle on its right or below it
+        bool top_left = t.edge[k][0] > 0 || (t.edge[k][0] == 0 && t.edge[k][1] > 0);
+        if (!top_left) t.edge[k][2] -= 1;
+    }
+    // Barycentric weight k is edge k over the area, planes are converted from subpixels to pixels
+    double inverse_area = 1.0 / double(area);
+    auto plane = [&](const double* values, float* out) {
+        double a = 0.0, b = 0.0, c = 0.0;
+        for (int k = 0; k < 3; k++) {
+            a += values[order[k]] * edge[k][0];
+            b += values[order[k]] * edge[k][1];
+            c += values[order[k]] * edge[k][2];
+        }
+        out[0] = float(a * SOFT_SUBPIXEL * inverse_area);
+        out[1] = float(b * SOFT_SUBPIXEL * inverse_area);
+        out[2] = float(c * inverse_area);
+    };
+    plane(z, t.z);
+    for (int k = 0; k < 5 && interpolate; k++) plane(q[k], t.attribute[k]);
+    t.color = color;
+    t.interpolate = interpolate;
+    t.depth_test = draw->depth_test;
+    t.depth_write = draw->depth_write;
+    return true;
+}
+
+static void _soft_raster_tile(_soft_renderer_t* r, const GXSoftwareRenderer* renderer, uint32_t tile) {
+    int tile_x = int(tile % r->tiles_x) * SOFT_TILE_SIZE;
+    int tile_y = int(tile / r->tiles_x) * SOFT_TILE_SIZE;
+    float center_x = tile_x + 0.5f;
+    int64_t subpixel_x = int64_t(tile_x) * SOFT_SUBPIXEL + SOFT_SUBPIXEL / 2;
+    for (uint32_t index : r->bins[tile]) {
+        const _soft_triangle_t& t = r->triangles[index];
+        int y0 = std::max(t.min_y, tile_y), y1 = std::min(t.max_y, tile_y + SOFT_TILE_SIZE - 1);
+        _soft_span_t span;
+        span.begin = std::max(t.min_x, tile_x) - tile_x;
+        span.end = std::min(t.max_x, tile_x + SOFT_TILE_SIZE - 1) - tile_x + 1;
+        span.color_value = t.color;
+        span.interpolate = t.interpolate;
+        span.depth_test = t.depth_test;
+        span.depth_write = t.depth_write;
+        for (int k = 0; k < 3; k++) span.edge_step[k] = int32_t(t.edge[k][0] * SOFT_SUBPIXEL);
+        span.z_step = t.z[0];
+        for (int k = 0; k < 5 && t.interpolate; k++) span.attribute_step[k] = t.attribute[k][0];
+
+        for (int y = y0; y <= y1; y++) {
+            float center_y = y + 0.5f;
+            int64_t subpixel_y = int64_t(y) * SOFT_SUBPIXEL + SOFT_SUBPIXEL / 2;
+            // Far edges are clamped, their sign cannot change within the 64 pixels of a tile row
+            for (int k = 0; k < 3; k++) {
+                int64_t e = t.edge[k][0] * subpixel_x + t.edge[k][1] * subpixel_y + t.edge[k][2];
+                span.edge[k] = int32_t(std::clamp<int64_t>(e, -(int64_t(1) << 30), int64_t(1) << 30));
+            }
+            span.z = t.z[0] * center_x + t.z[1] * center_y + t.z[2];
+            for (int k = 0; k < 5 && t.interpolate; k++) span.attribute[k] = t.attribute[k][0] * center_x + t.attribute[k][1] * center_y + t.attribute[k][2];
+            span.color = r->color.data() + size_t(y) * renderer->stride + tile_x;
+            span.depth = r->depth.data() + size_t(y) * renderer->stride + tile_x;
+            r->span(span);
+        }
+    }
+}
+
+static void _software_renderer_release(GXSoftwareRenderer* renderer) {
+    auto r = static_cast<_soft_renderer_t*>(renderer->internal);
+    {
+        std::lock_guard<std::mutex> lock(r->mutex);
+        r->stop = true;
+    }
+    r->wake.notify_all();
+    for (auto& worker : r->workers) worker.join();
+    delete r;
+}
+
+GXSoftwareRenderer* gxAsSoftwareRenderer(GXResource* res) { return static_cast<GXSoftwareRenderer*>(res->resource); }
+
+GXSoftwareRenderer* gxCreateSoftwareRenderer(const GXSoftwareRendererOptions* options) {
+    if (!m_app || !options || options->width <= 0 || options->height <= 0) return nullptr;
+    if (options->width > SOFT_MAX_SIZE || options->height > SOFT_MAX_SIZE) return nullptr;
+
+    GXSoftwareISA isa = _soft_supported_isa();
+    if (options->isa != GX_SOFTWARE_ISA_AUTO) isa = std::min(isa, options->isa);
+
+    _soft_renderer_t* internal = new _soft_renderer_t();
+    internal->tiles_x = (options->width + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+    internal->tiles_y = (options->height + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+    // Buffers are padded to whole tiles so vector loads never leave the tile
+    size_t pixel_count = size_t(internal->tiles_x) * internal->tiles_y * SOFT_TILE_SIZE * SOFT_TILE_SIZE;
+    internal->color.assign(pixel_count, 0);
+    internal->depth.assign(pixel_count, 1.0f);
+    internal->bins.resize(size_t(internal->tiles_x) * internal->tiles_y);
+    internal->span = _soft_span_scalar;
+#if defined(GX_X86)
+    if (isa == GX_SOFTWARE_ISA_SSE41) internal->span = _soft_span_sse41;
+    if (isa == GX_SOFTWARE_ISA_AVX2) internal->span = _soft_span_avx2;
+#endif
+
+    GXResource* resource = new GXResource{};
+    resource->type = GX_RESOURCE_SOFTWARE_RENDERER;
+    resource->status = GX_RESOURCE_STATUS_NONE;
+    GXSoftwareRenderer* renderer = new GXSoftwareRenderer{ resource, *options, isa, internal->color.data(), internal->depth.data(),
+                                                           uint32_t(internal->tiles_x * SOFT_TILE_SIZE), 0, internal };
+    resource->resource = renderer;
+
+    unsigned thread_count = options->thread_count ? options->thread_count : std::max(std::thread::hardware_concurrency(), 1u);
+    renderer->options.thread_count = thread_count;
+    for (unsigned i = 1; i < thread_count; i++) internal->workers.emplace_back(_soft_worker_main, internal);
+
+    _app_resource_collection_t* resource_collection = (_app_resource_collection_t*)m_app->resource_collection_vec_ptr;
+    resource_collection->insert(resource);
+    return renderer;
+}
+
+void gxSoftwareClear(GXSoftwareRenderer* renderer, const float* color, float depth) {
+    if (!renderer) return;
+    auto r = static_cast<_soft_renderer_t*>(renderer->internal);
+    // Queued triangles are only hidden when the color is cleared as well, a depth only clear keeps their pixels
+    if (!color) gxSoftwareFinish(renderer);
+    r->triangles.clear();
+    for (auto& bin : r->bins) bin.clear();
+
+    uint32_t value = color ? _soft_pack(color[0], color[1], color[2], color[3]) : 0;
+    size_t row_pixels = size_t(renderer->stride) * SOFT_TILE_SIZE;
+    _soft_parallel(r, uint32_t(r->tiles_y), [&](uint32_t row) {
+        if (color) std::fill_n(r->color.begin() + row * row_pixels, row_pixels, value);
+        std::fill_n(r->depth.begin() + row * row_pixels, row_pixels, depth);
+    });
+}
+
+bool gxSoftwareDraw(GXSoftwareRenderer* renderer, const GXSoftwareDraw* draw) {
+    if (!renderer || !draw || !draw->vertices || !draw->layout || !draw->model_view_projection) return false;
+    auto r = static_cast<_soft_renderer_t*>(renderer->internal);
+
+    const GXVertexAttribute* position = nullptr;
+    const GXVertexAttribute* normal = nullptr;
+    const GXVertexAttribute* vertex_color = nullptr;
+    for (uint32_t i = 0; i < draw->layout->attribute_count; i++) {
+        const GXVertexAttribute* attribute = &draw->layout->attributes[i];
+        if (attribute->size < 1 || attribute->size > 4) return false;
+        if (attribute->location == 0) position = attribute;
+        if (attribute->location == 1) normal = attribute;
+        if (attribute->location == 2) vertex_color = attribute;
+    }
+    if (!position || position->size < 2) return false;
+    if (draw->shading == GX_SOFTWARE_SHADING_LAMBERT && !normal) return false;
+
+    // Triangle list of vertex indices
+    std::vector<uint32_t> indices;
+    indices.reserve(draw->primitive == GX_PRIMITIVE_TRIANGLES ? draw->count : draw->count * 3);
+    auto vertex = [&](size_t i) { return draw->indices ? draw->indices[i] : uint32_t(i); };
+    switch (draw->primitive) {
+    case GX_PRIMITIVE_TRIANGLES:
+        for (size_t i = 0; i + 2 < draw->count; i += 3) indices.insert(indices.end(), { vertex(i), vertex(i + 1), vertex(i + 2) });
+        break;
+    case GX_PRIMITIVE_TRIANGLE_STRIP:
+        for (size_t i = 0; i + 2 < draw->count; i++) {
+            if (i & 1) indices.insert(indices.end(), { vertex(i + 1), vertex(i), vertex(i + 2) });
+            else indices.insert(indices.end(), { vertex(i), vertex(i + 1), vertex(i + 2) });
+        }
+        break;
+    case GX_PRIMITIVE_TRIANGLE_FAN:
+        for (size_t i = 1; i + 1 < draw->count; i++) indices.insert(indices.end(), { vertex(0), vertex(i), vertex(i + 1) });
+        break;
+    default:
+        return false;
+    }
+    if (indices.empty()) return true;
+    uint32_t vertex_count = *std::max_element(indices.begin(), indices.end()) + 1;
+
+    static const float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    const float* model = draw->model ? draw->model : identity;
+    float light[3] = { draw->light_direction[0], draw->light_direction[1], draw->light_direction[2] };
+    float light_length = std::sqrt(light[0] * light[0] + light[1] * light[1] + light[2] * light[2]);
+    if (light_length > 0.0f) for (float& l : light) l /= light_length;
+    else light[2] = 1.0f;
+
+    // Vertex stage: clip positions, shaded colors and, for faceted shading, lighting space positions
+    bool faceted = draw->shading == GX_SOFTWARE_SHADING_FACETED;
+    std::vector<_soft_vertex_t> vertices(vertex_count);
+    std::vector<float> positions(faceted ? size_t(vertex_count) * 3 : 0);
+    const uint8_t* data = static_cast<const uint8_t*>(draw->vertices);
+    _soft_parallel(r, (vertex_count + SOFT_VERTEX_CHUNK - 1) / SOFT_VERTEX_CHUNK, [&](uint32_t chunk) {
+        uint32_t end = std::min(vertex_count, (chunk + 1) * SOFT_VERTEX_CHUNK);
+        for (uint32_t i = chunk * SOFT_VERTEX_CHUNK; i < end; i++) {
+            const uint8_t* source = data + size_t(i) * draw->layout->stride;
+            float p[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+            _soft_fetch(source, position, p);
+            _soft_vertex_t& v = vertices[i];
+            _soft_transform(draw->model_view_projection, p, p[3], v.clip);
+
+            float base[4] = { draw->color[0], draw->color[1], draw->color[2], draw->color[3] };
+            if (vertex_color && draw->shading != GX_SOFTWARE_SHADING_FLAT) {
+                base[3] = 1.0f;
+                _soft_fetch(source, vertex_color, base);
+            }
+            if (draw->shading == GX_SOFTWARE_SHADING_LAMBERT) {
+                float n[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, world[4];
+                _soft_fetch(source, normal, n);
+                _soft_transform(model, n, 0.0f, world);
+                _soft_light(draw, world, light, base, v.color);
+            } else {
+                std::copy(base, base + 4, v.color);
+            }
+            if (faceted) {
+                float world[4];
+                _soft_transform(model, p, p[3], world);
+                std::copy(world, world + 3, &positions[size_t(i) * 3]);
+            }
+        }
+    });
+
+    // Triangle stage: clipping, setup and binning into per chunk lists, merged in submission order
+    bool interpolate = draw->shading == GX_SOFTWARE_SHADING_LAMBERT || (draw->shading == GX_SOFTWARE_SHADING_VERTEX_COLOR && vertex_color);
+    uint32_t triangle_count = uint32_t(indices.size() / 3);
+    uint32_t chunk_count = (triangle_count + SOFT_TRIANGLE_CHUNK - 1) / SOFT_TRIANGLE_CHUNK;
+    std::vector<std::vector<_soft_triangle_t>> chunk_triangles(chunk_count);
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> chunk_bins(chunk_count);
+    _soft_parallel(r, chunk_count, [&](uint32_t chunk) {
+        uint32_t end = std::min(triangle_count, (chunk + 1) * SOFT_TRIANGLE_CHUNK);
+        chunk_triangles[chunk].reserve(end - chunk * SOFT_TRIANGLE_CHUNK);
+        for (uint32_t i = chunk * SOFT_TRIANGLE_CHUNK; i < end; i++) {
+            const uint32_t* triangle = &indices[size_t(i) * 3];
+            _soft_vertex_t polygon[9];
+            for (int k = 0; k < 3; k++) polygon[k] = vertices[triangle[k]];
+
+            // The provoking vertex is the last one, as in OpenGL
+            const float* base = polygon[2].color;
+            uint32_t color = _soft_pack(base[0], base[1], base[2], base[3]);
+            if (faceted) {
+                const float* p0 = &positions[size_t(triangle[0]) * 3];
+                const float* p1 = &positions[size_t(triangle[1]) * 3];
+                const float* p2 = &positions[size_t(triangle[2]) * 3];
+                float a[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+                float b[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+                float n[3] = { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+                float lit[4];
+                _soft_light(draw, n, light, base, lit);
+                color = _soft_pack(lit[0], lit[1], lit[2], lit[3]);
+            }
+
+            bool inside = true;
+            for (int k = 0; k < 3 && inside; k++) {
+                const float* c = polygon[k].clip;
+                inside = std::abs(c[0]) <= c[3] && std::abs(c[1]) <= c[3] && std::abs(c[2]) <= c[3];
+            }
+            int count = inside ? 3 : _soft_clip(polygon, 3);
+            for (int k = 1; k + 1 < count; k++) {
+                const _soft_vertex_t* fan[3] = { &polygon[0], &polygon[k], &polygon[k + 1] };
+                _soft_triangle_t t;
+                if (!_soft_setup(renderer, draw, fan, interpolate, color, t)) continue;
+                uint32_t local = uint32_t(chunk_triangles[chunk].size());
+                chunk_triangles[chunk].push_back(t);
+                for (int ty = t.min_y / SOFT_TILE_SIZE; ty <= t.max_y / SOFT_TILE_SIZE; ty++) {
+                    for (int tx = t.min_x / SOFT_TILE_SIZE; tx <= t.max_x / SOFT_TILE_SIZE; tx++) chunk_bins[chunk].push_back({ uint32_t(ty * r->tiles_x + tx), local });
+                }
+            }
+        }
+    });
+
+    for (uint32_t chunk = 0; chunk < chunk_count; chunk++) {
+        uint32_t first = uint32_t(r->triangles.size());
+        r->triangles.insert(r->triangles.end(), chunk_triangles[chunk].begin(), chunk_triangles[chunk].end());
+        for (auto& [tile, local] : chunk_bins[chunk]) r->bins[tile].push_back(first + local);
+    }
+    if (r->triangles.size() >= SOFT_MAX_QUEUED_TRIANGLES) gxSoftwareFinish(renderer);
+    return true;
+}
+
+void gxSoftwareFinish(GXSoftwareRenderer* renderer) {
+    if (!renderer) return;
+    auto r = static_cast<_soft_renderer_t*>(renderer->internal);
+    if (r->triangles.empty()) return;
+    _soft_parallel(r, uint32_t(r->bins.size()), [&](uint32_t tile) { _soft_raster_tile(r, renderer, tile); });
+    renderer->triangle_count += r->triangles.size();
+    r->triangles.clear();
+    for (auto& bin : r->bins) bin.clear();
+}
+
+// Percentiles cover the most recent jobs only, a long running server neither grows nor sorts its whole history
+static const size_t _render_server_latency_window = 4096;
+
+struct _render_server_t {
+    const GXRenderServerOptions* options;
+    GXRenderTargetDesc desc;
+    uint64_t next_id = 1;
+    uint64_t completed = 0, failed = 0;
+    std::vector<double> latencies;  // Ring of the last completed jobs, overwritten from `latency_next` once full
+    size_t latency_next = 0;
+    double latency_max = 0.0;
+    bool started = false;
+    std::chrono::steady_clock::time_point first_received, last_completed;
+    bool quit = false;
+};
+
+static GXRenderServerStats _render_server_stats(const _render_server_t& s) {
+    GXRenderServerStats stats = {};
+    stats.jobs_completed = s.completed;
+    stats.jobs_failed = s.failed;
+    if (s.latencies.empty()) return stats;
+
+    double seconds = std::chrono::duration<double>(s.last_completed - s.first_received).count();
+    stats.jobs_per_second = seconds > 0.0 ? s.completed / seconds : 0.0;
+    std::vector<double> sorted = s.latencies;
+    auto percentile = [&](double p) {
+        auto nth = sorted.begin() + (size_t(std::ceil(p * sorted.size())) - 1);
+        std::nth_element(sorted.begin(), nth, sorted.end());
+        return *nth;
+    };
+    stats.latency_p50_ms = percentile(0.50);
+    stats.latency_p90_ms = percentile(0.90);
+    stats.latency_p99_ms = percentile(0.99);
+    stats.latency_max_ms = s.latency_max;
+    return stats;
+}
+
+// Rows are top to bottom
+static bool _render_server_write(const std::string& path, int width, int height, const std::vector<uint8_t>& pixels) {
+    auto has_extension = [&](const char* extension) {
+        size_t length = strlen(extension);
+        if (path.size() < length) return false;
+        for (size_t i = 0; i < length; i++) {
+            if (tolower((unsigned char)path[path.size() - length + i]) != extension[i]) return false;
+        }
+        return true;
+    };
+    if (has_extension(".png")) return stbi_write_png(path.c_str(), width, height, 4, pixels.data(), width * 4) != 0;
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) return false;
+    bool written = true;
+    if (has_extension(".ppm")) {
+        fprintf(file, "P6\n%d %d\n255\n", width, height);
+        std::vector<uint8_t> row(size_t(width) * 3);
+        for (int y = 0; y < height && written; y++) {
+            const uint8_t* source = pixels.data() + size_t(y) * width * 4;
+            for (int x = 0; x < width; x++) memcpy(&row[size_t(x) * 3], source + size_t(x) * 4, 3);
+            written = fwrite(row.data(), 1, row.size(), file) == row.size();
+        }
+    } else {
+        written = fwrite(pixels.data(), 1, pixels.size(), file) == pixels.size();
+    }
+    return fclose(file) == 0 && written;
+}
+
+static std::string _render_server_job(_render_server_t& s, const std::string& line, std::chrono::steady_clock::time_point received) {
+    uint64_t id = s.next_id++;
+    auto fail = [&](const std::string& message) {
+        s.failed++;
+        return "error " + std::to_string(id) + " " + message;
+    };
+
+    int width = 0, height = 0, scene_offset = -1;
+    char output[4096] = {};
+    if (sscanf(line.c_str(), "%*s %d %d %4095s %n", &width, &height, output, &scene_offset) < 3 || width <= 0 || height <= 0) {
+        return fail("malformed request");
+    }
+    const char* scene = scene_offset >= 0 ? line.c_str() + scene_offset : "";
+    if (!s.started) {
+        s.first_received = received;
+        s.started = true;
+    }
+
+    GXRenderTargetDesc desc = s.desc;
+    desc.width = width;
+    desc.height = height;
+    GXRenderTarget* target = gxAcquireTransientRenderTarget(&desc);
+    if (!target) return fail("could not create a " + std::to_string(width) + "x" + std::to_string(height) + " target");
+
+    int framebuffer = 0, read_framebuffer = 0, pack_buffer = 0, viewport[4] = {};
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read_framebuffer);
+    glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pack_buffer);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    gxBindRenderTarget(target);
+    GXRenderJob job = { id, width, height, output, scene, target };
+    bool rendered = s.options->render(&job, s.options->user_data);
+    std::vector<uint8_t> pixels;
+    if (rendered) {
+        gxResolveRenderTarget(target);
+        uint32_t source = target->resolve_framebuffer ? target->resolve_framebuffer : target->framebuffer;
+        glNamedFramebufferReadBuffer(source, GL_COLOR_ATTACHMENT0);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, source);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        pixels.resize(size_t(width) * height * 4);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        size_t pitch = size_t(width) * 4;
+        for (int y = 0; y < height / 2; y++) std::swap_ranges(pixels.begin() + y * pitch, pixels.begin() + (y + 1) * pitch, pixels.begin() + (height - 1 - y) * pitch);
+    }
+    gxReleaseTransientRenderTarget(target);
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, read_framebuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pack_buffer);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    // Every job is a frame for the transient target pool, targets of sizes no longer requested are evicted
+    _render_target_pool_collect(glfwGetCurrentContext());
+
+    if (!rendered) return fail("render callback failed");
+    if (!_render_server_write(output, width, height, pixels)) return fail(std::string("could not write ") + output);
+
+    s.last_completed = std::chrono::steady_clock::now();
+    double latency = std::chrono::duration<double, std::milli>(s.last_completed - received).count();
+    if (s.latencies.size() < _render_server_latency_window) s.latencies.push_back(latency);
+    else s.latencies[s.latency_next] = latency;
+    s.latency_next = (s.latency_next + 1) % _render_server_latency_window;
+    s.latency_max = std::max(s.latency_max, latency);
+    s.completed++;
+    char response[64];
+    snprintf(response, sizeof(response), "ok %llu %.3f", (unsigned long long)id, latency);
+    return response;
+}
+
+// Returns the response line, empty for blank requests; `received` is when the line was read, so queued time counts
+static std::string _render_server_request(_render_server_t& s, std::string line, std::chrono::steady_clock::time_point received) {
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) line.pop_back();
+    size_t begin = line.find_first_not_of(" \t");
+    if (begin == std::string::npos) return "";
+    std::string command = line.substr(begin, line.find_first_of(" \t", begin) - begin);
+
+    if (command == "render") return _render_server_job(s, line.substr(begin), received);
+    if (command == "stats") {
+        GXRenderServerStats stats = _render_server_stats(s);
+        char response[256];
+        snprintf(response, sizeof(response), "stats %llu %llu %.2f %.3f %.3f %.3f %.3f", (unsigned long long)stats.jobs_completed,
+                 (unsigned long long)stats.jobs_failed, stats.jobs_per_second, stats.latency_p50_ms, stats.latency_p90_ms,
+                 stats.latency_p99_ms, stats.latency_max_ms);
+        return response;
+    }
+    if (command == "quit") {
+        s.quit = true;
+        return "bye";
+    }
+    return "error 0 unknown request " + command;
+}
+
+#if defined(GX_UNIX_SOCKETS)
+static void _render_server_send(int fd, const std::string& response) {
+#if defined(MSG_NOSIGNAL)
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    std::string line = response + "\n";
+    for (size_t sent = 0; sent < line.size();) {
+        ssize_t count = send(fd, line.data() + sent, line.size() - sent, flags);
+        if (count < 0 && errno == EINTR) continue;
+        if (count <= 0) return;
+        sent += size_t(count);
+    }
+}
+
+static bool _render_server_listen(_render_server_t& s, const char* path) {
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path)) return false;
+    strcpy(address.sun_path, path);
+
+    // A stale socket of a previous server is replaced, any other file at the path is left alone and bind fails
+    struct stat existing;
+    if (lstat(path, &existing) == 0 && S_ISSOCK(existing.st_mode)) unlink(path);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) return false;
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(listener, SOMAXCONN) < 0) {
+        close(listener);
+        return false;
+    }
+
+    struct client_t {
+        int fd;
+        std::string input;
+        bool closed;
+    };
+    struct request_t {
+        int fd;
+        std::string line;
+        std::chrono::steady_clock::time_point received;
+    };
+    std::vector<client_t> clients;
+    std::vector<pollfd> fds;
+    std::vector<request_t> requests;
+    while (!s.quit) {
+        fds.assign(1, { listener, POLLIN, 0 });
+        for (auto& client : clients) fds.push_back({ client.fd, POLLIN, 0 });
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        // Every ready client is read before serving, so a request waiting behind another client's jobs is timed from its arrival
+        for (size_t i = 1; i < fds.size(); i++) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+            client_t& client = clients[i - 1];
+            char buffer[4096];
+            ssize_t count = recv(client.fd, buffer, sizeof(buffer), 0);
+            if (count <= 0) {
+                client.closed = true;
+                continue;
+            }
+            auto received = std::chrono::steady_clock::now();
+            client.input.append(buffer, size_t(count));
+            size_t end;
+            while ((end = client.input.find('\n')) != std::string::npos) {
+                requests.push_back({ client.fd, client.input.substr(0, end), received });
+                client.input.erase(0, end + 1);
+            }
+        }
+
+        // Requests are served in arrival order, one client at a time
+        for (const auto& request : requests) {
+            if (s.quit) break;
+            std::string response = _render_server_request(s, request.line, request.received);
+            if (!response.empty()) _render_server_send(request.fd, response);
+        }
+        requests.clear();
+        for (auto& client : clients) {
+            if (client.closed) close(client.fd);
+        }
+        clients.erase(std::remove_if(clients.begin(), clients.end(), [](const client_t& client) { return client.closed; }), clients.end());
+
+        if (fds[0].revents & POLLIN) {
+            int fd = accept(listener, nullptr, nullptr);
+            if (fd >= 0) clients.push_back({ fd, {}, false });
+        }
+    }
+
+    for (auto& client : clients) close(client.fd);
+    close(listener);
+    unlink(path);
+    return true;
+}
+#endif
+
+bool gxRenderServe(const GXRenderServerOptions* options, GXRenderServerStats* out_stats) {
+    if (!options || !options->render) return false;
+
+    _render_server_t s;
+    s.options = options;
+    s.desc = options->desc;
+    if (!s.desc.color_count) {
+        s.desc.color_formats[0] = GL_RGBA8;
+        s.desc.color_count = 1;
+        if (!s.desc.depth_format) s.desc.depth_format = GL_DEPTH24_STENCIL8;
+    }
+
+    bool served = true;
+    if (options->socket_path) {
+#if defined(GX_UNIX_SOCKETS)
+        served = _render_server_listen(s, options->socket_path);
+#else
+        served = false;
+#endif
+    } else {
+        std::string line;
+        char buffer[4096];
+        while (!s.quit && fgets(buffer, sizeof(buffer), stdin)) {
+            line += buffer;
+            if (line.back() != '\n' && !feof(stdin)) continue;
+            std::string response = _render_server_request(s, line, std::chrono::steady_clock::now());
+            line.clear();
+            if (response.empty()) continue;
+            fputs(response.c_str(), stdout);
+            fputc('\n', stdout);
+            fflush(stdout);
+        }
+    }
+
+    if (out_stats) *out_stats = _render_server_stats(s);
+    return served;
+}
+
+struct _gpu_scope_t {
+    std::string name;
+    uint32_t depth;
+    uint64_t samples = 0;
+    double last_ms = 0.0, min_ms = 0.0, total_ms = 0.0, max_ms = 0.0;
+};
+
+struct _gpu_scope_sample_t {
+    uint32_t scope;
+    uint32_t begin, end;    // GL_TIMESTAMP queries
+};
+
+// Query objects are not shared between contexts, every context keeps its own pool and open scopes
+struct _gpu_profiler_context_t {
+    std::vector<uint32_t> free_queries;
+    std::vector<std::pair<uint32_t, uint32_t>> open;  // Scope and its begin query, innermost last
+    std::deque<_gpu_scope_sample_t> pending;          // Oldest first, timestamps finish in order
+};
+
+static std::deque<_gpu_scope_t> m_gpu_scopes;  // A deque so appending never moves the names handed out by gxGetGpuScopeStats
+static std::unordered_map<std::string, uint32_t> m_gpu_scope_index;
+static std::unordered_map<void*, _gpu_profiler_context_t> m_gpu_profiler;
+
+static uint32_t _gpu_profiler_query(_gpu_profiler_context_t& profiler) {
+    uint32_t query = 0;
+    if (profiler.free_queries.empty()) {
+        glGenQueries(1, &query);
+    } else {
+        query = profiler.free_queries.back();
+        profiler.free_queries.pop_back();
+    }
+    glQueryCounter(query, GL_TIMESTAMP);
+    return query;
+}
+
+static void _gpu_profiler_resolve(void* context) {
+    auto it = m_gpu_profiler.find(context);
+    if (it == m_gpu_profiler.end()) return;
+    _gpu_profiler_context_t& profiler = it->second;
+    while (!profiler.pending.empty()) {
+        const _gpu_scope_sample_t& sample = profiler.pending.front();
+        int available = 0;
+        glGetQueryObjectiv(sample.end, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        uint64_t begin = 0, end = 0;
+        glGetQueryObjectui64v(sample.begin, GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(sample.end, GL_QUERY_RESULT, &end);
+        double ms = end > begin ? (end - begin) / 1e6 : 0.0;
+        _gpu_scope_t& scope = m_gpu_scopes[sample.scope];
+        scope.min_ms = scope.samples ? std::min(scope.min_ms, ms) : ms;
+        scope.max_ms = scope.samples ? std::max(scope.max_ms, ms) : ms;
+        scope.last_ms = ms;
+        scope.total_ms += ms;
+        scope.samples++;
+
+        profiler.free_queries.push_back(sample.begin);
+        profiler.free_queries.push_back(sample.end);
+        profiler.pending.pop_front();
+    }
+}
+
+// The queries were deleted with the context
+static void _gpu_profiler_forget(void* context) {
+    m_gpu_profiler.erase(context);
+}
+
+void gxGpuScopeBegin(const char* name) {
+    if (!name) return;
+    _gpu_profiler_context_t& profiler = m_gpu_profiler[glfwGetCurrentContext()];
+    std::string path = profiler.open.empty() ? name : m_gpu_scopes[profiler.open.back().first].name + "/" + name;
+    auto [it, inserted] = m_gpu_scope_index.try_emplace(path, uint32_t(m_gpu_scopes.size()));
+    if (inserted) m_gpu_scopes.push_back({ path, uint32_t(profiler.open.size()) });
+    profiler.open.push_back({ it->second, _gpu_profiler_query(profiler) });
+}
+
+void gxGpuScopeEnd() {
+    auto it = m_gpu_profiler.find(glfwGetCurrentContext());
+    if (it == m_gpu_profiler.end() || it->second.open.empty()) return;
+    _gpu_profiler_context_t& profiler = it->second;
+    auto [scope, begin] = profiler.open.back();
+    profiler.open.pop_back();
+    profiler.pending.push_back({ scope, begin, _gpu_profiler_query(profiler) });
+}
+
+void gxResolveGpuScopes() {
+    _gpu_profiler_resolve(glfwGetCurrentContext());
+}
+
+size_t gxGetGpuScopeStats(GXGpuScopeStats* out_stats, size_t capacity) {
+    size_t count = 0;
+    for (const _gpu_scope_t& scope : m_gpu_scopes) {
+        if (!scope.samples) continue;
+        if (out_stats && count < capacity) {
+            out_stats[count] = { scope.name.c_str(), scope.depth, scope.samples, scope.last_ms, scope.min_ms,
+                                 scope.total_ms / scope.samples, scope.max_ms };
+        }
+        count++;
+    }
+    return count;
+}
+
+void gxResetGpuScopeStats() {
+    for (_gpu_scope_t& scope : m_gpu_scopes) {
+        scope.samples = 0;
+        scope.last_ms = scope.min_ms = scope.total_ms = scope.max_ms = 0.0;
+    }
+}
+
+size_t gxDumpGpuScopes(char* buffer, size_t size) {
+    std::string table;
+    char line[256];
+    snprintf(line, sizeof(line), "%-32s %10s %10s %10s %10s %10s\n", "GPU scope", "samples", "last ms", "min ms", "avg ms", "max ms");
+    table += line;
+    for (const _gpu_scope_t& scope : m_gpu_scopes) {
+        if (!scope.samples) continue;
+        size_t separator = scope.name.rfind('/');
+        std::string label = std::string(scope.depth * 2, ' ') + (separator == std::string::npos ? scope.name : scope.name.substr(separator + 1));
+        snprintf(line, sizeof(line), "%-32s %10llu %10.3f %10.3f %10.3f %10.3f\n", label.c_str(), (unsigned long long)scope.samples,
+                 scope.last_ms, scope.min_ms, scope.total_ms / scope.samples, scope.max_ms);
+        table += line;
+    }
+    if (buffer && size) {
+        size_t length = std::min(table.size(), size - 1);
+        memcpy(buffer, table.data(), length);
+        buffer[length] = '\0';
+    }
+    return table.size();
+}
@@ -48,6 +48,19 @@ extern "C" {
 	 *  - \ref GXShaderType
 	 *  - \ref GXMappingBits
 	 *  - \ref GXVertexAttributeType
+	 *  - \ref GXBoundsType
+	 *  - \ref GXPrimitiveType
+	 *  - \ref GXUniformType
+	 *  - \ref GXBundleOptions
+	 *  - \ref GXSpriteSortMode
+	 *  - \ref GXDebugDrawFlags
+	 *  - \ref GXProgramInterface
+	 *  - \ref GXPixelFormat
+	 *  - \ref GXCaptureFormat
+	 *  - \ref GXCaptureBackpressure
+	 *  - \ref GXTiledOutputFormat
+	 *  - \ref GXSoftwareShading
+	 *  - \ref GXSoftwareISA
 	 */
 
 	/** \page Basics Core Library Initialization
@@ -72,6 +85,8 @@ extern "C" {
 	/** \fn const char* gxInit()
 	 *  \brief Initializes GX library and dependencies (GLFW).
 	 *  \return nullptr on success, error message on failure.
+	 *  \note When no display server is available GLFW falls back to its null platform, only GX_APP_OPTION_HEADLESS
+	 *  applications can create windows then.
 	 *  \see gxTerminate()
 	 */
 	GX_API const char* gxInit();
@@ -214,9 +229,12 @@ extern "C" {
 	 *
 	 *  Values:
 	 *  - `GX_APP_OPTION_NONE`: Default options
+	 *  - `GX_APP_OPTION_HEADLESS`: Windows are offscreen contexts on the GLFW null platform, created through OSMesa or
+	 *    EGL, so the application runs without X11/Wayland (e.g. Mesa llvmpipe on render and CI nodes)
 	 */
 	typedef enum  {
 		GX_APP_OPTION_NONE = 0,
+		GX_APP_OPTION_HEADLESS = 1,
 	} GXApplicationOptions;
 
 	/*! \struct GXApplication
@@ -294,10 +312,36 @@ extern "C" {
 	 *  Values:
 	 *  - `GX_RESOURCE_WINDOW`: Window resource
 	 *  - `GX_RSOURCE_OBJECT`: Renderable object resource
+	 *  - `GX_RESOURCE_CULLING_STAGE`: GPU culling stage resource
+	 *  - `GX_RESOURCE_COMMAND_LIST`: Command list resource
+	 *  - `GX_RESOURCE_RENDER_BUNDLE`: Compiled render bundle resource
+	 *  - `GX_RESOURCE_SPRITE_BATCH`: Sprite batch resource
+	 *  - `GX_RESOURCE_PENDING_PROGRAM`: Asynchronously compiled program resource
+	 *  - `GX_RESOURCE_PROGRAM_REFLECTION`: Program reflection resource
+	 *  - `GX_RESOURCE_SHADER_VARIANT_SET`: Shader variant set resource
+	 *  - `GX_RESOURCE_READBACK_RING`: Asynchronous pixel readback ring resource
+	 *  - `GX_RESOURCE_CAPTURE`: Frame capture resource
+	 *  - `GX_RESOURCE_RENDER_TARGET`: Offscreen render target resource
+	 *  - `GX_RESOURCE_RENDER_GRAPH`: Render graph resource
+	 *  - `GX_RESOURCE_DYNAMIC_RESOLUTION`: Dynamic resolution controller resource
+	 *  - `GX_RESOURCE_SOFTWARE_RENDERER`: CPU rasterizer resource
 	 */
 	typedef enum {
 		GX_RESOURCE_WINDOW,
-		GX_RESOURCE_OBJECT
+		GX_RESOURCE_OBJECT,
+		GX_RESOURCE_CULLING_STAGE,
+		GX_RESOURCE_COMMAND_LIST,
+		GX_RESOURCE_RENDER_BUNDLE,
+		GX_RESOURCE_SPRITE_BATCH,
+		GX_RESOURCE_PENDING_PROGRAM,
+		GX_RESOURCE_PROGRAM_REFLECTION,
+		GX_RESOURCE_SHADER_VARIANT_SET,
+		GX_RESOURCE_READBACK_RING,
+		GX_RESOURCE_CAPTURE,
+		GX_RESOURCE_RENDER_TARGET,
+		GX_RESOURCE_RENDER_GRAPH,
+		GX_RESOURCE_DYNAMIC_RESOLUTION,
+		GX_RESOURCE_SOFTWARE_RENDERER
 	} GXResourceType;
 
 	/*! \enum GXResourceStatus
@@ -340,11 +384,15 @@ extern "C" {
 	 *  - `GX_BUFFER_TYPE_ARRAY`: Vertex array buffer
 	 *  - `GX_BUFFER_TYPE_ELEMENT_ARRAY`: Element array buffer
 	 *  - `GX_BUFFER_TYPE_UNIFORM`: Uniform buffer
+	 *  - `GX_BUFFER_TYPE_SHADER_STORAGE`: Shader storage buffer (SSBO)
+	 *  - `GX_BUFFER_TYPE_DRAW_INDIRECT`: Indirect draw command buffer
 	 */
 	typedef enum {
 		GX_BUFFER_TYPE_ARRAY = 0x8892,
 		GX_BUFFER_TYPE_ELEMENT_ARRAY = 0x8893,
-		GX_BUFFER_TYPE_UNIFORM = 0x8A11
+		GX_BUFFER_TYPE_UNIFORM = 0x8A11,
+		GX_BUFFER_TYPE_SHADER_STORAGE = 0x90D2,
+		GX_BUFFER_TYPE_DRAW_INDIRECT = 0x8F3F
 	} GXBufferType;
 
 	/*! \enum GXBufferBit
@@ -417,24 +465,46 @@ extern "C" {
 	 *  - `program_log`: Compilation log message
 	 *  - `vertex_result`: Vertex shader compilation result
 	 *  - `fragment_result`: Fragment shader compilation result
+	 *  - `compute_result`: Compute shader compilation result (only used by gxCompileGLSLComputeProgram)
+	 *  - `tess_control_result`: Tessellation control shader compilation result
+	 *  - `tess_evaluation_result`: Tessellation evaluation shader compilation result
+	 *  - `geometry_result`: Geometry shader compilation result
 	 */
 	struct GXProgramCompilationResult {
 		uint32_t program;
 		int success;
 		char program_log[1024];
 		GXShaderCompilationResult vertex_result, fragment_result;
+		GXShaderCompilationResult compute_result;
+		GXShaderCompilationResult tess_control_result, tess_evaluation_result, geometry_result;
 	};
 
+	/*! \typedef void (*GXShaderReloadCallback)(GXObject*, const GXProgramCompilationResult*)
+	 *  \brief Shader hot reload callback, called on the main thread after every reload attempt.
+	 *  \param object Object whose shader files changed
+	 *  \param result Compilation result, the program is already swapped in if it succeeded
+	 */
+	typedef void (*GXShaderReloadCallback)(GXObject*, const GXProgramCompilationResult*);
+
 	/*! \enum GXShaderType
-	 *  \brief Shader type bindings for glads GL_FRAGMENT_SHADER, and GL_VERTEX_SHADER.
+	 *  \brief Shader type bindings for glads GL_FRAGMENT_SHADER, GL_VERTEX_SHADER, GL_COMPUTE_SHADER, GL_GEOMETRY_SHADER,
+	 *  GL_TESS_CONTROL_SHADER and GL_TESS_EVALUATION_SHADER.
 	 *
 	 *  Values:
 	 *  - `GX_GLSL_FRAGMENT_SHADER`: Fragment shader type
 	 *  - `GX_GLSL_VERTEX_SHADER`: Vertex shader type
+	 *  - `GX_GLSL_COMPUTE_SHADER`: Compute shader type
+	 *  - `GX_GLSL_GEOMETRY_SHADER`: Geometry shader type
+	 *  - `GX_GLSL_TESS_CONTROL_SHADER`: Tessellation control shader type
+	 *  - `GX_GLSL_TESS_EVALUATION_SHADER`: Tessellation evaluation shader type
 	 */
 	typedef enum {
 		GX_GLSL_FRAGMENT_SHADER = 0x8B30,
-		GX_GLSL_VERTEX_SHADER = 0x8B31
+		GX_GLSL_VERTEX_SHADER = 0x8B31,
+		GX_GLSL_COMPUTE_SHADER = 0x91B9,
+		GX_GLSL_GEOMETRY_SHADER = 0x8DD9,
+		GX_GLSL_TESS_CONTROL_SHADER = 0x8E88,
+		GX_GLSL_TESS_EVALUATION_SHADER = 0x8E87
 	} GXShaderType;
 
 	/*! \enum GXMappingBits
@@ -484,397 +554,2790 @@ extern "C" {
 		GX_VERTEX_ATTRIB_TYPE_FLOAT = 0x1406
 	} GXVertexAttributeType;
 
-
-	/** \fn bool gxAddKeyboardCallback(GXKeyboardCallback cb)
-	 *  \brief Registers a keyboard event callback.
-	 *  \param cb Callback function to register
-	 */
-	GX_API void gxAddKeyboardCallback(GXKeyboardCallback cb);
-
-	/** \fn bool gxClearKeyboardCallback()
-	 *  \brief Clears all keyboard callbacks.
+	/*! \enum GXPrimitiveType
+	 *  \brief Primitive topology bindings for glads GL_POINTS, GL_LINES, GL_TRIANGLES, etc.
+	 *
+	 *  Values:
+	 *  - `GX_PRIMITIVE_POINTS`: Every vertex is a point
+	 *  - `GX_PRIMITIVE_LINES`: Every 2 vertices form a line
+	 *  - `GX_PRIMITIVE_LINE_LOOP`: Connected lines, the last vertex connects back to the first
+	 *  - `GX_PRIMITIVE_LINE_STRIP`: Connected lines
+	 *  - `GX_PRIMITIVE_TRIANGLES`: Every 3 vertices form a triangle
+	 *  - `GX_PRIMITIVE_TRIANGLE_STRIP`: Every vertex after the first 2 forms a triangle with the 2 before it
+	 *  - `GX_PRIMITIVE_TRIANGLE_FAN`: Every vertex after the first 2 forms a triangle with the first and the previous vertex
+	 *  - `GX_PRIMITIVE_LINES_ADJACENCY`: Lines with adjacency information (geometry shaders)
+	 *  - `GX_PRIMITIVE_LINE_STRIP_ADJACENCY`: Line strip with adjacency information (geometry shaders)
+	 *  - `GX_PRIMITIVE_TRIANGLES_ADJACENCY`: Triangles with adjacency information (geometry shaders)
+	 *  - `GX_PRIMITIVE_TRIANGLE_STRIP_ADJACENCY`: Triangle strip with adjacency information (geometry shaders)
+	 *  - `GX_PRIMITIVE_PATCHES`: Patches of gxSetPatchVertices vertices, consumed by tessellation shaders
 	 */
-	GX_API void gxClearKeyboardCallback();
-
-	/** \fn void gxDestroyApplication(GXApplication* application)
-	 *  \brief Releases application resources.
-	 *  \param application Application context to destroy
+	typedef enum {
+		GX_PRIMITIVE_POINTS = 0x0000,
+		GX_PRIMITIVE_LINES = 0x0001,
+		GX_PRIMITIVE_LINE_LOOP = 0x0002,
+		GX_PRIMITIVE_LINE_STRIP = 0x0003,
+		GX_PRIMITIVE_TRIANGLES = 0x0004,
+		GX_PRIMITIVE_TRIANGLE_STRIP = 0x0005,
+		GX_PRIMITIVE_TRIANGLE_FAN = 0x0006,
+		GX_PRIMITIVE_LINES_ADJACENCY = 0x000A,
+		GX_PRIMITIVE_LINE_STRIP_ADJACENCY = 0x000B,
+		GX_PRIMITIVE_TRIANGLES_ADJACENCY = 0x000C,
+		GX_PRIMITIVE_TRIANGLE_STRIP_ADJACENCY = 0x000D,
+		GX_PRIMITIVE_PATCHES = 0x000E
+	} GXPrimitiveType;
+
+	/*! \enum GXUniformType
+	 *  \brief Uniform data type bindings for glads GL_FLOAT, GL_FLOAT_VEC2, GL_FLOAT_MAT4, etc.
+	 *
+	 *  Values:
+	 *  - `GX_UNIFORM_TYPE_FLOAT`, `GX_UNIFORM_TYPE_VEC2`, `GX_UNIFORM_TYPE_VEC3`, `GX_UNIFORM_TYPE_VEC4`: 32-bit floating point scalar/vectors
+	 *  - `GX_UNIFORM_TYPE_INT`, `GX_UNIFORM_TYPE_IVEC2`, `GX_UNIFORM_TYPE_IVEC3`, `GX_UNIFORM_TYPE_IVEC4`: 32-bit signed integer scalar/vectors
+	 *  - `GX_UNIFORM_TYPE_UINT`, `GX_UNIFORM_TYPE_UVEC2`, `GX_UNIFORM_TYPE_UVEC3`, `GX_UNIFORM_TYPE_UVEC4`: 32-bit unsigned integer scalar/vectors
+	 *  - `GX_UNIFORM_TYPE_MAT3`: 3x3 column-major floating point matrix
+	 *  - `GX_UNIFORM_TYPE_MAT4`: 4x4 column-major floating point matrix
 	 */
-	GX_API void gxDestroyApplication(GXApplication* application);
-
-	/** \fn GXApplication* gxCreateApplication(GXApplicationOptions options)
-	 *  \brief Creates main application context.
-	 *  \param options Configuration flags
-	 *  \return Pointer to application context
+	typedef enum {
+		GX_UNIFORM_TYPE_FLOAT = 0x1406,
+		GX_UNIFORM_TYPE_VEC2 = 0x8B50,
+		GX_UNIFORM_TYPE_VEC3 = 0x8B51,
+		GX_UNIFORM_TYPE_VEC4 = 0x8B52,
+		GX_UNIFORM_TYPE_INT = 0x1404,
+		GX_UNIFORM_TYPE_IVEC2 = 0x8B53,
+		GX_UNIFORM_TYPE_IVEC3 = 0x8B54,
+		GX_UNIFORM_TYPE_IVEC4 = 0x8B55,
+		GX_UNIFORM_TYPE_UINT = 0x1405,
+		GX_UNIFORM_TYPE_UVEC2 = 0x8DC6,
+		GX_UNIFORM_TYPE_UVEC3 = 0x8DC7,
+		GX_UNIFORM_TYPE_UVEC4 = 0x8DC8,
+		GX_UNIFORM_TYPE_MAT3 = 0x8B5B,
+		GX_UNIFORM_TYPE_MAT4 = 0x8B5C
+	} GXUniformType;
+
+	/*! \struct GXCommandList
+	 *  \brief List of recorded gx commands that can be replayed on the thread owning the GL context.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `command_count`: Number of recorded commands
+	 *  - `stream_ptr`: Recorded command stream
 	 */
-	GX_API GXApplication* gxCreateApplication(GXApplicationOptions options);
+	struct GXCommandList {
+		GXResource* resource;
+		uint32_t command_count;
+		void* stream_ptr;
+	};
 
-	/** \fn GXApplication* gxGetApplication()
-	 *  \brief Retrieves current application context.
-	 *  \return Pointer to application context (null if not initialized)
+	/*! \enum GXBundleOptions
+	 *  \brief Render bundle compilation flags.
+	 *
+	 *  Values:
+	 *  - `GX_BUNDLE_OPTION_NONE`: Keep the recorded draw order
+	 *  - `GX_BUNDLE_OPTION_SORT`: Sort draws by program and vertex array between state changes (uniform writes, buffer updates, clears, ...) to maximize merged draws, only use this if the draw order does not matter (e.g. opaque geometry)
 	 */
-	GX_API GXApplication* gxGetApplication();
+	typedef enum {
+		GX_BUNDLE_OPTION_NONE = 0,
+		GX_BUNDLE_OPTION_SORT = 1
+	} GXBundleOptions;
 
-	/** \fn void gxExec()
-	 *	\brief Executes the current application.
-	 */
-	GX_API void gxExec();
+	/*! \struct GXRenderBundle
+	 *  \brief Prerecorded, flattened and state-deduplicated command stream.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `valid`: false once an object referenced by the bundle has been destroyed
+	 *  - `options`: Compilation flags
+	 *  - `command_count`: Number of commands after compilation
+	 *  - `draw_count`: Number of draw calls issued per execution
+	 *  - `indirect_buffer`: Indirect draw command buffer holding the merged draws (0 if none were merged)
+	 *  - `stream_ptr`: Compiled command stream
+	 *  - `objects_ptr`: Objects referenced by the bundle
+	 */
+	struct GXRenderBundle {
+		GXResource* resource;
+		bool valid;
+		GXBundleOptions options;
+		uint32_t command_count, draw_count;
+		uint32_t indirect_buffer;
+		void* stream_ptr;
+		void* objects_ptr;
+	};
 
-	/** \fn GXObject* gxAsObject(GXResource* res)
-	 *  \brief Returns a memory pointer to GXObject from the specified GXResource.
-	 *  \param res Resource memory pointer
-	 *  \return Associated object
+	/*! \enum GXSpriteSortMode
+	 *  \brief Order in which a sprite batch draws its queued sprites.
+	 *
+	 *  Values:
+	 *  - `GX_SPRITE_SORT_NONE`: Submission order, a new draw is issued whenever the texture or shader changes
+	 *  - `GX_SPRITE_SORT_TEXTURE`: Sprites are grouped by shader and texture (stable), resulting in the least draws
 	 */
-	GX_API GXObject* gxAsObject(GXResource* res);
+	typedef enum {
+		GX_SPRITE_SORT_NONE = 0,
+		GX_SPRITE_SORT_TEXTURE = 1
+	} GXSpriteSortMode;
 
-	/** \fn GXObject* gxCreateStaticObject(uint32_t shader_program, uint32_t vao, uint32_t vbo, uint32_t ebo, void* user_data)
-	 *  \brief Creates and initiatlizes an static GXObject in memory.
-	 *  \param shader_program Shader program id
-	 *  \param vao Vertex array object id
-	 *  \param vbo Vertex buffer object id
-	 *  \param ebo Element buffer object id (optional, can be 0)
-	 *  \param user_data User-defined data pointer (can be null)
-	 *  \return Pointer to object
-	 *  \note All memory is managed by the libary and does not account for the manual freeing of memory outside of its codebase.
-	 */
-	GX_API GXObject* gxCreateObject(uint32_t shader_program, uint32_t vao, uint32_t vbo, uint32_t ebo, void* user_data);
+	/*! \struct GXSprite
+	 *  \brief A single textured, colored and rotated quad.
+	 *
+	 *  Members:
+	 *  - `x`, `y`: Position of the sprites origin
+	 *  - `width`, `height`: Size of the sprite
+	 *  - `rotation`: Rotation around the origin in radians
+	 *  - `origin_x`, `origin_y`: Origin relative to the sprites size (0.5, 0.5 is the center)
+	 *  - `u0`, `v0`, `u1`, `v1`: Texture coordinate rectangle
+	 *  - `color`: Packed RGBA8 color multiplied with the texture (red in the lowest byte)
+	 *  - `texture`: Texture id (0 draws the color only)
+	 *  - `shader_program`: Shader program id (0 uses the built-in sprite shader)
+	 */
+	struct GXSprite {
+		float x, y;
+		float width, height;
+		float rotation;
+		float origin_x, origin_y;
+		float u0, v0, u1, v1;
+		uint32_t color;
+		uint32_t texture;
+		uint32_t shader_program;
+	};
 
-	/** \fn GXObject* gxCreateRenderObject(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data, GXBufferUsageType elem_buffer_usage, size_t elem_size, void* elem_data, void* user_data)
-	 *  \brief Creates and initializes a renderable GXObject in memory.
-	 *  \param shader_program Shader program id
-	 *  \param vert_buffer_usage Buffer usage type for vertex buffer
-	 *  \param vert_size Size of vertex data in bytes
-	 *  \param vert_data Pointer to vertex data (can be null)
-	 *  \param elem_buffer_usage Buffer usage type for element buffer
-	 *  \param elem_size Size of element data in bytes
-	 *  \param elem_data Pointer to element data (can be null)
-	 *  \param user_data User-defined data pointer (can be null)
-	 *  \return Pointer to object
-	 * 
-	 *  \note Requires gxBindObject(...) to be called to ensure it works.
+	/*! \struct GXSpriteBatch
+	 *  \brief Accumulates sprites into a streaming vertex buffer and draws them with as few draws as possible.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `capacity`: Maximum number of sprites drawn by a single flush, queuing more flushes automatically
+	 *  - `sort_mode`: Order of the queued sprites
+	 *  - `draw_count`: Number of draws issued since gxSpriteBatchBegin
+	 *  - `projection`: Column-major projection matrix used by the current batch
+	 *  - `default_program`: Built-in sprite shader program id
+	 *  - `white_texture`: 1x1 white texture used for sprites without texture
+	 *  - `vao`: Vertex array object id
+	 *  - `vbo`: Streaming vertex buffer object id
+	 *  - `ebo`: Static element buffer object id shared by every flush
+	 *  - `sprites_ptr`: Queued sprites
 	 */
-	GX_API GXObject* gxCreateRenderObjectWithElements(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data, GXBufferUsageType elem_buffer_usage, size_t elem_size, void* elem_data, void* user_data);
+	struct GXSpriteBatch {
+		GXResource* resource;
+		uint32_t capacity;
+		GXSpriteSortMode sort_mode;
+		uint32_t draw_count;
+		float projection[16];
+		uint32_t default_program, white_texture, vao, vbo, ebo;
+		void* sprites_ptr;
+	};
 
-	/** \fn GXObject* gxCreateRenderObject(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data)
-	 *  \brief Creates and initializes a renderable GXObject in memory without an element buffer.
-	 *  \param shader_program Shader program id
-	 *  \param vert_buffer_usage Buffer usage type for vertex buffer
-	 *  \param vert_size Size of vertex data in bytes
-	 *  \param vert_data Pointer to vertex data (can be null)
-	 *  \param user_data User-defined data pointer (can be null)
-	 *  \return Pointer to object
-	 * 
-	 *  \note Requires gxBindObject(...) to be called to ensure it works.
+	/*! \enum GXDebugDrawFlags
+	 *  \brief Debug drawing flags.
+	 *
+	 *  Values:
+	 *  - `GX_DEBUG_DRAW_NONE`: Drawn on top of the scene
+	 *  - `GX_DEBUG_DRAW_DEPTH_TEST`: Depth tested against the scene
 	 */
-	GX_API GXObject* gxCreateRenderObject(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data, void* user_data);
+	typedef enum {
+		GX_DEBUG_DRAW_NONE = 0,
+		GX_DEBUG_DRAW_DEPTH_TEST = 1
+	} GXDebugDrawFlags;
 
-	/** \fn void gxDrawVertices(GXObject* object, size_t offset, size_t count)
-	 *  \brief Draws a set of vertices from GXObject.
-	 *  \param object Object pointer
-	 *  \param offset Vertex offset
-	 *  \param count Vertex count
+	/*! \enum GXBoundsType
+	 *  \brief Bounding volume used by a GPU culling stage.
+	 *
+	 *  Values:
+	 *  - `GX_BOUNDS_SPHERE`: Bounding sphere, `center.xyz` is the center and `center.w` the radius
+	 *  - `GX_BOUNDS_AABB`: Axis aligned bounding box, `center.xyz` is the center and `extents.xyz` the half extents
 	 */
-	GX_API void gxDrawVertices(GXObject* object, size_t offset, size_t count);
+	typedef enum {
+		GX_BOUNDS_SPHERE = 0,
+		GX_BOUNDS_AABB = 1
+	} GXBoundsType;
 
-	/** \fn void gxDrawElements(GXObject* object, size_t offset, size_t count)
-	 *  \brief Draws a set of elements from GXObject.
-	 *  \param object Object pointer
-	 *  \param count Element count
-	 *  \param type Element type
+	/*! \struct GXInstanceBounds
+	 *  \brief World space bounds of a single instance, laid out to match std430.
+	 *
+	 *  Members:
+	 *  - `center`: Center of the bounds (`w` holds the radius for GX_BOUNDS_SPHERE)
+	 *  - `extents`: Half extents of the bounds (only used for GX_BOUNDS_AABB)
 	 */
-	GX_API void gxDrawElements(GXObject* object, size_t count, GXVertexAttributeType type);
+	struct GXInstanceBounds {
+		float center[4];
+		float extents[4];
+	};
 
-	/** \fn void gxBindObject(GXObject* object)
-	 *  \brief Binds all data stored in object, effectively making it work
-	 *  \param object Object pointer
-	 */
-	GX_API void gxBindObject(GXObject* object);
+	/*! \struct GXCullingStage
+	 *  \brief GPU frustum culling stage that produces an indirect draw for a GXObject.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `object`: Object drawn with the culled instances
+	 *  - `bounds_type`: Bounding volume type of `bounds_buffer`
+	 *  - `primitive`: Primitive topology of the indirect draw (GX_PRIMITIVE_TRIANGLES by default)
+	 *  - `capacity`: Maximum number of instances
+	 *  - `instance_count`: Number of instances tested by the next dispatch
+	 *  - `count`: Vertex (or element) count of a single instance
+	 *  - `element_type`: Element type, only used when `object` has an element buffer
+	 *  - `visible_binding`: Shader storage binding point the visible instance indices are bound to when drawing
+	 *  - `cull_program`: Compute program performing the frustum test
+	 *  - `bounds_buffer`: Shader storage buffer holding a GXInstanceBounds per instance
+	 *  - `visible_buffer`: Shader storage buffer receiving the indices of the visible instances
+	 *  - `command_buffer`: Indirect draw command buffer written by the culling pass
+	 */
+	struct GXCullingStage {
+		GXResource* resource;
+		GXObject* object;
+		GXBoundsType bounds_type;
+		GXPrimitiveType primitive;
+		uint32_t capacity, instance_count, count;
+		GXVertexAttributeType element_type;
+		uint32_t visible_binding;
+		uint32_t cull_program, bounds_buffer, visible_buffer, command_buffer;
+	};
 
-	/** \fn GXWindow* gxAsWindow(GXResource* res)
-	 *  \brief Returns a memory pointer to GXWindow from the specified GXResource.
-	 *  \param res Resource memory pointer
-	 *  \return Associated window
-	 */
-	GX_API GXWindow* gxAsWindow(GXResource* res);
+	/*! \struct GXProgramCacheStats
+	 *  \brief Statistics of the program binary cache.
+	 *
+	 *  Members:
+	 *  - `hits`: Programs loaded from a cached binary
+	 *  - `misses`: Programs compiled from source because no usable binary was cached
+	 *  - `rejected`: Cached binaries the driver refused to load (included in `misses`)
+	 *  - `stores`: Program binaries written to the cache directory
+	 *  - `hit_ms`: Total time spent loading programs on hits in milliseconds
+	 *  - `miss_ms`: Total time spent compiling, linking and storing programs on misses in milliseconds
+	 */
+	struct GXProgramCacheStats {
+		uint32_t hits, misses, rejected, stores;
+		double hit_ms, miss_ms;
+	};
 
-	/** \fn GXWindow* gxCreateWindow(bool vsync, bool show, int width, int height, const char* title)
-	 *  \brief Creates and initiatlizes an GXWindow in memory.
-	 *  \param vsync Sync frame rate wuth refresh rate of monitor to prevent "screen tearing"
-	 *  \param show Should the window be shown or hidden after creation
-	 *  \param width The desired width, in screen coordinates, of the window content area
-	 *  \param height The desired height, in screen coordinates, of the window content area
-	 *  \param title The title of the window
-	 *  \return Pointer to window
-	 *  \note All memory is managed by the libary and does not account for the manual freeing of memory outside of its codebase. Furthermore, events regarding the framebuffer does NOT interrupt drawing, this may be optional in the future.
+	/*! \struct GXProgramSources
+	 *  \brief Sources of one program for gxCompileGLSLProgramsAsync.
+	 *
+	 *  Members:
+	 *  - `vertex_shader_src`: Source code of the vertex shader
+	 *  - `fragment_shader_src`: Source code of the fragment shader
 	 */
-	GX_API GXWindow* gxCreateWindow(bool vsync, bool show, int width, int height, const char* title);
+	struct GXProgramSources {
+		const char* vertex_shader_src;
+		const char* fragment_shader_src;
+	};
 
-	/** \fn void gxWindowSetDrawCallback(GXWindow* win, GXDrawCallback cb)
-	 *  \brief Assigns the draw callback for the respective GXWindow.
-	 *  \param win Pointer to window to assign callback to
-	 *  \param cb Callback (GXDrawCallback)
-	 */
-	GX_API void gxWindowSetDrawCallback(GXWindow* win, GXDrawCallback cb);
+	/*! \struct GXProgramStageSources
+	 *  \brief Sources of every graphics stage of a program for gxCompileGLSLProgramStages, nullptr leaves a stage out.
+	 *
+	 *  Members:
+	 *  - `vertex_shader_src`: Source code of the vertex shader (required)
+	 *  - `tess_control_shader_src`: Source code of the tessellation control shader
+	 *  - `tess_evaluation_shader_src`: Source code of the tessellation evaluation shader
+	 *  - `geometry_shader_src`: Source code of the geometry shader
+	 *  - `fragment_shader_src`: Source code of the fragment shader
+	 */
+	struct GXProgramStageSources {
+		const char* vertex_shader_src;
+		const char* tess_control_shader_src;
+		const char* tess_evaluation_shader_src;
+		const char* geometry_shader_src;
+		const char* fragment_shader_src;
+	};
 
-	/** \fn void gxWindowClose(GXWindow* win)
-	 *  \brief Inidicates to the libary, that the specified window should close.
-	 *  \param win GXWindow to close
+	/*! \struct GXPendingProgram
+	 *  \brief Program being compiled and linked asynchronously.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to parent resource
+	 *  - `ready`: Set by gxPollProgram or gxWaitProgram once `result` holds the compilation result
+	 *  - `result`: Compilation result, only valid once `ready` is set
+	 *  - `internal`: Internal compilation state
 	 */
-	GX_API void gxWindowClose(GXWindow* win);
+	struct GXPendingProgram {
+		GXResource* resource;
+		bool ready;
+		GXProgramCompilationResult result;
+		void* internal;
+	};
 
-	/** \fn bool gxWindowShouldClose(GXWindow* win)
-	 *  \brief Returns whether the status of the specified window indicates it should close.
-	 *  \param win The GXWindow to query
-	 *  \return true if the window should close, false if otherwise.
+	/*! \enum GXProgramInterface
+	 *  \brief Program interfaces enumerated by gxReflectProgram.
+	 *
+	 *  Values:
+	 *  - `GX_PROGRAM_INTERFACE_UNIFORM`: Uniforms of the default block
+	 *  - `GX_PROGRAM_INTERFACE_UNIFORM_BLOCK`: Uniform blocks
+	 *  - `GX_PROGRAM_INTERFACE_STORAGE_BLOCK`: Shader storage blocks
+	 *  - `GX_PROGRAM_INTERFACE_ATTRIBUTE`: Vertex attributes
 	 */
-	GX_API bool gxWindowShouldClose(GXWindow* win);
+	typedef enum {
+		GX_PROGRAM_INTERFACE_UNIFORM,
+		GX_PROGRAM_INTERFACE_UNIFORM_BLOCK,
+		GX_PROGRAM_INTERFACE_STORAGE_BLOCK,
+		GX_PROGRAM_INTERFACE_ATTRIBUTE
+	} GXProgramInterface;
+
+	/*! \struct GXShaderVariable
+	 *  \brief Active uniform, block or attribute of a reflected program.
+	 *
+	 *  Members:
+	 *  - `name`: Name as reported by GL, arrays keep their `[0]` suffix
+	 *  - `name_hash`: gxHashName of `name`
+	 *  - `location`: Location of uniforms and attributes, binding point of blocks
+	 *  - `type`: GL type of uniforms and attributes (a GXUniformType for the types it lists), 0 for blocks
+	 *  - `size`: Array size of uniforms and attributes, buffer data size of blocks in bytes
+	 */
+	struct GXShaderVariable {
+		const char* name;
+		uint32_t name_hash;
+		int32_t location;
+		uint32_t type;
+		int32_t size;
+	};
 
-	/** \fn bool gxDestroyResource(GXResource* resource)
-	 *  \brief Destroy and free the specified resource.
-	 *  \param resource The GXResource to destroy
-	 *  \return true if the resource was successfully destroyed, false if it was not (likely due to memory issues).
+	/*! \struct GXProgramReflection
+	 *  \brief Active interface of a linked program, looked up by precomputed name hashes.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to parent resource
+	 *  - `program`: Reflected shader program id
+	 *  - `counts`: Number of variables per GXProgramInterface
+	 *  - `variables`: Variables per GXProgramInterface
+	 *  - `internal`: Internal lookup tables
 	 */
-	GX_API bool gxDestroyResource(GXResource* resource);
+	struct GXProgramReflection {
+		GXResource* resource;
+		uint32_t program;
+		uint32_t counts[4];
+		const GXShaderVariable* variables[4];
+		void* internal;
+	};
 
-	/** \fn void gxUpdateViewport(GXWindow* win)
-	 *  \brief Updates the viewport for a specific window (equivalent to gxViewport(0, 0, win->width, win->height)).
-	 *  \param win The GXWindow to update the viewport for.
-	 * 
-	 *  \note This should only be used in the drawing callback of a window.
-	 *  
-	 *  \see gxViewport()
+	/*! \struct GXShaderVariantSet
+	 *  \brief Vertex and fragment source compiled into one program per requested keyword combination.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to parent resource
+	 *  - `keyword_count`: Number of feature keywords, keyword `i` is bit `i` of a variant mask
+	 *  - `variant_count`: Number of variant masks requested so far
+	 *  - `program_count`: Number of programs compiled for them, variants with identical preprocessed sources share one
+	 *  - `internal`: Internal variant state
 	 */
-	GX_API void gxUpdateViewport(GXWindow* win);
+	struct GXShaderVariantSet {
+		GXResource* resource;
+		uint32_t keyword_count;
+		uint32_t variant_count;
+		uint32_t program_count;
+		void* internal;
+	};
 
-	/** \fn void gxSetBackground(float r, float g, float b, float a)
-	 *  \brief Sets the background for the respective graphical context.
-	 *  \param r R/RED channel value ranged between 0.0 to 1.0
-	 *  \param g G/GREEN channel value ranged between 0.0 to 1.0
-	 *  \param b B/BLUE channel value ranged between 0.0 to 1.0
-	 *  \param a A/ALPHA channel value ranged between 0.0 to 1.0
+	/*! \struct GXPipelineStages
+	 *  \brief Separable stage programs combined into a program pipeline, 0 leaves a stage empty.
 	 *
-	 * Is the same as doing:
-	 * \code
-	 * gxClearColor(r, g, b, a);
-	 * gxClearColorBuffer();
-	 * \endcode
+	 *  Members:
+	 *  - `vertex`: Separable vertex stage program
+	 *  - `fragment`: Separable fragment stage program
+	 *  - `compute`: Separable compute stage program, only combined with no other stage
+	 *  - `tess_control`: Separable tessellation control stage program
+	 *  - `tess_evaluation`: Separable tessellation evaluation stage program
+	 *  - `geometry`: Separable geometry stage program
+	 */
+	struct GXPipelineStages {
+		uint32_t vertex;
+		uint32_t fragment;
+		uint32_t compute;
+		uint32_t tess_control;
+		uint32_t tess_evaluation;
+		uint32_t geometry;
+	};
+
+	/*! \struct GXSpecializationConstant
+	 *  \brief Value of a SPIR-V specialization constant.
 	 *
-	 * \see gxClearColor()
-	 * \see gxClearColorBuffer()
+	 *  Members:
+	 *  - `id`: Constant id (`layout(constant_id = ...)` in GLSL)
+	 *  - `value`: Constant value, bit pattern of a 32-bit bool, int, uint or float
 	 */
-	GX_API void gxSetBackground(float r, float g, float b, float a);
+	struct GXSpecializationConstant {
+		uint32_t id;
+		uint32_t value;
+	};
 
-	/** \fn void gxViewport(int x, int y, int w, int h)
-	 *  \brief Sets the viewport for the respective graphical context.
-	 *  \param x Viewport x position
-	 *  \param y Viewport y position
-	 *  \param w Viewport width
-	 *  \param h Viewport height
+	/*! \struct GXSPIRVModule
+	 *  \brief Precompiled SPIR-V module of one program stage.
 	 *
-	 *  \note This is the same as glViewport, and simply a wrapper to allow easier binding implementation.
-	 */
-	GX_API void gxViewport(int x, int y, int w, int h);
+	 *  Members:
+	 *  - `code`: SPIR-V words
+	 *  - `size`: Size of `code` in bytes
+	 *  - `type`: Stage of the module
+	 *  - `entry_point`: Entry point name, nullptr for `main`
+	 *  - `constants`: Specialization constants, nullptr if `constant_count` is 0
+	 *  - `constant_count`: Number of specialization constants
+	 */
+	struct GXSPIRVModule {
+		const void* code;
+		size_t size;
+		GXShaderType type;
+		const char* entry_point;
+		const GXSpecializationConstant* constants;
+		uint32_t constant_count;
+	};
 
-	/** \fn void gxClearColor(float r, float g, float b, float a)
-	 *  \brief Sets the clear color for the respective graphical context.
-	 *  \param r R/RED channel value ranged between 0.0 to 1.0
-	 *  \param g G/GREEN channel value ranged between 0.0 to 1.0
-	 *  \param b B/BLUE channel value ranged between 0.0 to 1.0
-	 *  \param a A/ALPHA channel value ranged between 0.0 to 1.0
+	/*! \struct GXVertexAttribute
+	 *  \brief One vertex attribute of a GXVertexLayout.
 	 *
-	 *  \note This is the same as glClearColor(...), and simply a wrapper to allow easier binding implementation.
-	 */
-	GX_API void gxClearColor(float r, float g, float b, float a);
+	 *  Members:
+	 *  - `location`: Attribute location
+	 *  - `size`: Number of components (1 to 4)
+	 *  - `type`: Component type
+	 *  - `normalized`: Fixed-point components are normalized to [0, 1] or [-1, 1]
+	 *  - `integer`: The attribute is read as an integer (`ivec`/`uvec`) instead of a float
+	 *  - `offset`: Byte offset inside a vertex
+	 */
+	struct GXVertexAttribute {
+		uint32_t location;
+		int size;
+		GXVertexAttributeType type;
+		bool normalized;
+		bool integer;
+		uint32_t offset;
+	};
 
-	/** \fn void gxClear(unsigned int bit)
-	 *  \brief Sets the bitplane area for the respective graphical context.
-	 *  \param bit GXBufferBit
+	/*! \struct GXVertexLayout
+	 *  \brief Vertex format read from a single interleaved buffer.
 	 *
-	 *  \note This is the same as glClear(...), and simply a wrapper to allow easier binding implementation.
+	 *  Members:
+	 *  - `attributes`: Vertex attributes
+	 *  - `attribute_count`: Number of vertex attributes
+	 *  - `stride`: Size of a vertex in bytes
+	 */
+	struct GXVertexLayout {
+		const GXVertexAttribute* attributes;
+		uint32_t attribute_count;
+		uint32_t stride;
+	};
+
+	/*! \struct GXRenderState
+	 *  \brief Fixed-function state a draw is issued with.
 	 *
-	 *  \see GXBufferBit
-	 */
+	 *  Members:
+	 *  - `primitive`: Primitive type
+	 *  - `index_type`: Element type of indexed draws, 0 for non-indexed draws
+	 *  - `depth_test`: GL_DEPTH_TEST enabled
+	 *  - `depth_write`: Depth writes enabled
+	 *  - `blend`: GL_BLEND enabled
+	 *  - `cull_face`: GL_CULL_FACE enabled
+	 *  - `blend_src`: Source blend factor (e.g. GL_SRC_ALPHA), used when `blend` is set
+	 *  - `blend_dst`: Destination blend factor (e.g. GL_ONE_MINUS_SRC_ALPHA), used when `blend` is set
+	 *  - `color_format`: Internal format of the color target, 0 for GL_RGBA8
+	 *  - `depth_format`: Internal format of the depth target, 0 for none
+	 *  - `samples`: Samples of the targets, 0 for single sampled
+	 */
+	struct GXRenderState {
+		GXPrimitiveType primitive;
+		uint32_t index_type;
+		bool depth_test, depth_write, blend, cull_face;
+		uint32_t blend_src, blend_dst;
+		uint32_t color_format, depth_format;
+		int samples;
+	};
+
+	/*! \struct GXPrewarmEntry
+	 *  \brief Program, vertex layout and render state combination warmed up by gxPrewarm.
+	 *
+	 *  Members:
+	 *  - `program`: Shader program id
+	 *  - `layout`: Vertex layout, nullptr for draws without vertex attributes
+	 *  - `state`: Render state
+	 */
+	struct GXPrewarmEntry {
+		uint32_t program;
+		const GXVertexLayout* layout;
+		GXRenderState state;
+	};
+
+	/*! \struct GXHitchRecord
+	 *  \brief Combination drawn for the first time while a frame was being drawn.
+	 *
+	 *  Members:
+	 *  - `program`: Shader program id
+	 *  - `vao`: Vertex array object drawn
+	 *  - `state`: Render state of the draw, target formats are not tracked and left 0
+	 *  - `frame`: Frame index, counted by gxExec
+	 *  - `draw_ms`: CPU time of the draw call in milliseconds, the time a deferred driver compile shows up in
+	 */
+	struct GXHitchRecord {
+		uint32_t program;
+		uint32_t vao;
+		GXRenderState state;
+		uint64_t frame;
+		double draw_ms;
+	};
+
+	/*! \enum GXPixelFormat
+	 *  \brief Layout of pixels read back from a framebuffer.
+	 *
+	 *  Values:
+	 *  - `GX_PIXEL_FORMAT_RGBA8`: 4 unsigned bytes per pixel
+	 *  - `GX_PIXEL_FORMAT_BGRA8`: 4 unsigned bytes per pixel, blue first (the native order of most video encoders)
+	 *  - `GX_PIXEL_FORMAT_RGB8`: 3 unsigned bytes per pixel
+	 *  - `GX_PIXEL_FORMAT_R8`: 1 unsigned byte per pixel, red channel only
+	 *  - `GX_PIXEL_FORMAT_RGBA16F`: 4 half floats per pixel
+	 *  - `GX_PIXEL_FORMAT_RGBA32F`: 4 floats per pixel
+	 *  - `GX_PIXEL_FORMAT_DEPTH32F`: 1 float depth value per pixel
+	 */
+	typedef enum {
+		GX_PIXEL_FORMAT_RGBA8,
+		GX_PIXEL_FORMAT_BGRA8,
+		GX_PIXEL_FORMAT_RGB8,
+		GX_PIXEL_FORMAT_R8,
+		GX_PIXEL_FORMAT_RGBA16F,
+		GX_PIXEL_FORMAT_RGBA32F,
+		GX_PIXEL_FORMAT_DEPTH32F
+	} GXPixelFormat;
+
+	/*! \struct GXReadbackRing
+	 *  \brief Ring of pixel pack buffers that framebuffer reads are queued into without waiting for the GPU.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `slot_count`: Number of pixel pack buffers, reads older than `slot_count` tickets are recycled
+	 *  - `dropped`: Number of completed reads recycled before they were mapped
+	 *  - `internal`: Internal ring state
+	 */
+	struct GXReadbackRing {
+		GXResource* resource;
+		uint32_t slot_count;
+		uint64_t dropped;
+		void* internal;
+	};
+
+	/*! \struct GXReadbackResult
+	 *  \brief Mapped pixels of a completed read.
+	 *
+	 *  Members:
+	 *  - `data`: Pixels, rows are tightly packed and ordered bottom to top
+	 *  - `size`: Size of `data` in bytes
+	 *  - `width`: Width of the read rectangle in pixels
+	 *  - `height`: Height of the read rectangle in pixels
+	 *  - `format`: Pixel format
+	 *  - `row_pitch`: Size of a row in bytes
+	 *  - `frame`: gxExec frame index the read was queued in
+	 */
+	struct GXReadbackResult {
+		const void* data;
+		size_t size;
+		int width, height;
+		GXPixelFormat format;
+		size_t row_pitch;
+		uint64_t frame;
+	};
+
+	/*! \enum GXCaptureFormat
+	 *  \brief Output of a frame capture.
+	 *
+	 *  Values:
+	 *  - `GX_CAPTURE_PNG_SEQUENCE`: One PNG file per frame, `path` is a printf pattern with a single `ll` integer conversion receiving the frame number (e.g. "frames/%06llu.png")
+	 *  - `GX_CAPTURE_Y4M`: YUV4MPEG2 4:2:0 video stream, readable by ffmpeg and most encoders
+	 *  - `GX_CAPTURE_RAW_RGBA`: Headerless stream of top-to-bottom RGBA8 frames
+	 */
+	typedef enum {
+		GX_CAPTURE_PNG_SEQUENCE,
+		GX_CAPTURE_Y4M,
+		GX_CAPTURE_RAW_RGBA
+	} GXCaptureFormat;
+
+	/*! \enum GXCaptureBackpressure
+	 *  \brief Behaviour of a frame capture when the encoders fall behind.
+	 *
+	 *  Values:
+	 *  - `GX_CAPTURE_BACKPRESSURE_DROP`: Frames are dropped, the render loop never waits
+	 *  - `GX_CAPTURE_BACKPRESSURE_BLOCK`: The render loop waits for queue space, every frame is written
+	 */
+	typedef enum {
+		GX_CAPTURE_BACKPRESSURE_DROP,
+		GX_CAPTURE_BACKPRESSURE_BLOCK
+	} GXCaptureBackpressure;
+
+	/*! \struct GXCaptureOptions
+	 *  \brief Frame capture configuration.
+	 *
+	 *  Members:
+	 *  - `format`: Output format
+	 *  - `path`: PNG file pattern or stream file path, streams starting with '|' are piped to the command that follows (e.g. "| ffmpeg -i - out.mp4")
+	 *  - `fps`: Frame rate written to the Y4M header
+	 *  - `queue_capacity`: Maximum number of frames waiting for a worker, 0 for 8
+	 *  - `worker_count`: Number of encoding threads, 0 for half the hardware threads up to 4
+	 *  - `backpressure`: Behaviour when the queue is full
+	 */
+	struct GXCaptureOptions {
+		GXCaptureFormat format;
+		const char* path;
+		uint32_t fps;
+		uint32_t queue_capacity;
+		uint32_t worker_count;
+		GXCaptureBackpressure backpressure;
+	};
+
+	/*! \struct GXCaptureStats
+	 *  \brief Frame capture counters.
+	 *
+	 *  Members:
+	 *  - `captured`: Frames submitted to the capture
+	 *  - `written`: Frames encoded and written
+	 *  - `dropped`: Frames dropped by the backpressure policy
+	 *  - `failed`: Frames that could not be encoded or written
+	 *  - `queued`: Frames currently waiting for a readback or a worker
+	 *  - `fps`: Frames written during the last second
+	 *  - `average_fps`: Frames written per second since the first frame
+	 *  - `encode_ms`: Average encoding and writing time of a frame in milliseconds
+	 */
+	struct GXCaptureStats {
+		uint64_t captured, written, dropped, failed;
+		uint32_t queued;
+		double fps, average_fps, encode_ms;
+	};
+
+	/*! \struct GXCapture
+	 *  \brief Streams framebuffer reads through asynchronous readbacks to encoding worker threads.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `options`: Capture configuration, `path` is copied
+	 *  - `internal`: Internal capture state
+	 */
+	struct GXCapture {
+		GXResource* resource;
+		GXCaptureOptions options;
+		void* internal;
+	};
+
+	/*! \struct GXRenderTargetDesc
+	 *  \brief Size, formats and sample count of a render target.
+	 *
+	 *  Members:
+	 *  - `width`: Width in pixels
+	 *  - `height`: Height in pixels
+	 *  - `color_formats`: Internal formats of the color attachments (e.g. GL_RGBA8, GL_RGBA16F)
+	 *  - `color_count`: Number of color attachments, up to 4
+	 *  - `depth_format`: Internal format of the depth attachment (e.g. GL_DEPTH24_STENCIL8), 0 for none
+	 *  - `samples`: Samples per pixel, 0 or 1 for single sampled
+	 */
+	struct GXRenderTargetDesc {
+		int width, height;
+		uint32_t color_formats[4];
+		uint32_t color_count;
+		uint32_t depth_format;
+		int samples;
+	};
+
+	/*! \struct GXRenderTarget
+	 *  \brief Framebuffer object with its attachments.
+	 *
+	 *  Multisampled targets draw into multisample renderbuffers and are resolved into the textures by
+	 *  gxResolveRenderTarget; single sampled targets draw into the textures directly.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container, nullptr for targets owned by the transient pool or a render graph
+	 *  - `desc`: Size, formats and sample count
+	 *  - `framebuffer`: Framebuffer drawn into
+	 *  - `resolve_framebuffer`: Framebuffer of the resolved textures, 0 when single sampled
+	 *  - `color_textures`: Sampleable color textures
+	 *  - `depth_texture`: Sampleable depth texture, 0 without depth attachment
+	 *  - `color_buffers`: Multisample color renderbuffers, 0 when single sampled
+	 *  - `depth_buffer`: Multisample depth renderbuffer, 0 when single sampled or without depth attachment
+	 *  - `transient`: The target belongs to the transient pool
+	 */
+	struct GXRenderTarget {
+		GXResource* resource;
+		GXRenderTargetDesc desc;
+		uint32_t framebuffer, resolve_framebuffer;
+		uint32_t color_textures[4], depth_texture;
+		uint32_t color_buffers[4], depth_buffer;
+		bool transient;
+	};
+
+	struct GXRenderGraph;
+
+	/*! \typedef void (*GXRenderPassCallback)(GXRenderGraph*, uint32_t, void*)
+	 *  \brief Render graph pass execution callback type.
+	 *  \param graph Render graph being executed
+	 *  \param pass Pass handle
+	 *  \param user_data User-defined data pointer given to gxRenderGraphAddPass
+	 */
+	typedef void (*GXRenderPassCallback)(GXRenderGraph* graph, uint32_t pass, void* user_data);
+
+	/*! \struct GXRenderGraph
+	 *  \brief Frame graph of passes declaring the resources they read and write.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `pass_count`: Number of passes declared
+	 *  - `culled_pass_count`: Number of passes culled by the last compile
+	 *  - `barrier_count`: Number of memory barriers inserted by the last compile
+	 *  - `virtual_resource_count`: Number of transient textures and buffers declared
+	 *  - `physical_resource_count`: Number of render targets and buffers backing them after aliasing
+	 *  - `internal`: Internal graph state
+	 */
+	struct GXRenderGraph {
+		GXResource* resource;
+		uint32_t pass_count, culled_pass_count, barrier_count;
+		uint32_t virtual_resource_count, physical_resource_count;
+		void* internal;
+	};
+
+	/*! \struct GXDynamicResolutionOptions
+	 *  \brief Dynamic resolution controller configuration.
+	 *
+	 *  Members:
+	 *  - `target_ms`: GPU time budget of the scaled scene rendering in milliseconds
+	 *  - `min_scale`: Lowest render scale, 0 for 0.5
+	 *  - `max_scale`: Highest render scale, 0 for 1.0
+	 *  - `kp`, `ki`, `kd`: Proportional, integral and derivative gains applied to the relative frame time error, 0 for 0.2, 0.1 and 0.02
+	 *  - `desc`: Formats and sample count of the scene target, its size is managed by the controller
+	 */
+	struct GXDynamicResolutionOptions {
+		double target_ms;
+		float min_scale, max_scale;
+		float kp, ki, kd;
+		GXRenderTargetDesc desc;
+	};
+
+	/*! \struct GXDynamicResolution
+	 *  \brief Renders the scene at a scale adjusted to hold a GPU frame time, then upscales it to the window.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `options`: Controller configuration
+	 *  - `scale`: Current render scale on each axis
+	 *  - `gpu_ms`: Last measured GPU time of the scene in milliseconds
+	 *  - `width`: Width of the scaled scene in pixels
+	 *  - `height`: Height of the scaled scene in pixels
+	 *  - `target`: Scene render target, sized for `max_scale`, the scene covers its bottom-left `width` x `height` pixels
+	 *  - `internal`: Internal controller state
+	 */
+	struct GXDynamicResolution {
+		GXResource* resource;
+		GXDynamicResolutionOptions options;
+		float scale;
+		double gpu_ms;
+		int width, height;
+		GXRenderTarget* target;
+		void* internal;
+	};
+
+	/*! \enum GXTiledOutputFormat
+	 *  \brief Output of a tiled render.
+	 *
+	 *  Values:
+	 *  - `GX_TILED_OUTPUT_PPM`: Single binary PPM (P6) image, tiles are written in place so the file is the only full copy
+	 *  - `GX_TILED_OUTPUT_RAW_RGBA`: Single headerless top-to-bottom RGBA8 image, written in place like PPM
+	 *  - `GX_TILED_OUTPUT_PNG_TILES`: One PNG per tile, `path` is a printf pattern with two int conversions receiving the column and row (e.g. "tiles/%d_%d.png")
+	 */
+	typedef enum {
+		GX_TILED_OUTPUT_PPM,
+		GX_TILED_OUTPUT_RAW_RGBA,
+		GX_TILED_OUTPUT_PNG_TILES
+	} GXTiledOutputFormat;
+
+	/*! \struct GXTile
+	 *  \brief Tile of a tiled render passed to its draw callback.
+	 *
+	 *  Members:
+	 *  - `column`, `row`: Position of the tile in the grid, row 0 is the top of the image
+	 *  - `x`, `y`: Top-left pixel of the tile in the image
+	 *  - `width`, `height`: Size of the tile in pixels, edge tiles may be smaller
+	 *  - `projection`: Column-major crop matrix, multiplying the full image projection on the left (`projection * full_projection`) renders this tile
+	 *  - `context_index`: Index of the context drawing the tile, 0 is the calling context
+	 *  - `target`: Render target bound for the tile, the viewport covers its bottom-left `width` x `height` pixels
+	 */
+	struct GXTile {
+		int column, row;
+		int x, y;
+		int width, height;
+		float projection[16];
+		uint32_t context_index;
+		GXRenderTarget* target;
+	};
+
+	/*! \typedef void (*GXTileDrawCallback)(const GXTile*, void*)
+	 *  \brief Tiled render draw callback type.
+	 *  \param tile Tile to draw
+	 *  \param user_data User-defined data pointer given to gxRenderTiled
+	 */
+	typedef void (*GXTileDrawCallback)(const GXTile* tile, void* user_data);
+
+	/*! \struct GXTiledRenderOptions
+	 *  \brief Tiled render configuration.
+	 *
+	 *  Members:
+	 *  - `width`, `height`: Size of the full image in pixels
+	 *  - `tile_width`, `tile_height`: Size of a tile, 0 for the largest size the driver renders (up to 4096)
+	 *  - `desc`: Formats and sample count of the tile target, its size is managed by the render; 0 formats for GL_RGBA8 and GL_DEPTH24_STENCIL8
+	 *  - `format`: Output format
+	 *  - `path`: Output file path or PNG tile pattern
+	 *  - `context_count`: Number of contexts drawing tiles in parallel, 0 or 1 draws on the calling context only
+	 */
+	struct GXTiledRenderOptions {
+		int width, height;
+		int tile_width, tile_height;
+		GXRenderTargetDesc desc;
+		GXTiledOutputFormat format;
+		const char* path;
+		uint32_t context_count;
+	};
+
+	/*! \enum GXSoftwareShading
+	 *  \brief Built-in shading model of a software draw.
+	 *
+	 *  Values:
+	 *  - `GX_SOFTWARE_SHADING_FLAT`: Every pixel takes the draw color
+	 *  - `GX_SOFTWARE_SHADING_VERTEX_COLOR`: Vertex colors (location 2) interpolated with perspective correction
+	 *  - `GX_SOFTWARE_SHADING_LAMBERT`: Diffuse lighting of the vertex normals (location 1), evaluated per vertex and interpolated
+	 *  - `GX_SOFTWARE_SHADING_FACETED`: Diffuse lighting of the triangle normal, one color per triangle
+	 */
+	typedef enum {
+		GX_SOFTWARE_SHADING_FLAT,
+		GX_SOFTWARE_SHADING_VERTEX_COLOR,
+		GX_SOFTWARE_SHADING_LAMBERT,
+		GX_SOFTWARE_SHADING_FACETED
+	} GXSoftwareShading;
+
+	/*! \enum GXSoftwareISA
+	 *  \brief Instruction set of the software rasterizer inner loop.
+	 *
+	 *  Values:
+	 *  - `GX_SOFTWARE_ISA_AUTO`: Best instruction set supported by the CPU
+	 *  - `GX_SOFTWARE_ISA_SCALAR`: One pixel at a time, portable C++
+	 *  - `GX_SOFTWARE_ISA_SSE41`: 4 pixels at a time (x86 SSE4.1)
+	 *  - `GX_SOFTWARE_ISA_AVX2`: 8 pixels at a time (x86 AVX2)
+	 */
+	typedef enum {
+		GX_SOFTWARE_ISA_AUTO,
+		GX_SOFTWARE_ISA_SCALAR,
+		GX_SOFTWARE_ISA_SSE41,
+		GX_SOFTWARE_ISA_AVX2
+	} GXSoftwareISA;
+
+	/*! \struct GXSoftwareRendererOptions
+	 *  \brief Software renderer configuration.
+	 *
+	 *  Members:
+	 *  - `width`, `height`: Size of the color and depth buffers in pixels, up to 32768
+	 *  - `thread_count`: Number of threads rasterizing, including the calling one, 0 for the hardware threads
+	 *  - `isa`: Highest instruction set used, capped to the ones supported by the CPU
+	 */
+	struct GXSoftwareRendererOptions {
+		int width, height;
+		uint32_t thread_count;
+		GXSoftwareISA isa;
+	};
+
+	/*! \struct GXSoftwareDraw
+	 *  \brief Triangles drawn by gxSoftwareDraw.
+	 *
+	 *  Members:
+	 *  - `vertices`: Interleaved vertex data
+	 *  - `layout`: Vertex layout, positions at location 0 (2 to 4 components), normals at location 1 and colors at location 2
+	 *  - `indices`: 32-bit indices, nullptr to draw `count` vertices in order
+	 *  - `count`: Number of indices or vertices
+	 *  - `primitive`: GX_PRIMITIVE_TRIANGLES, GX_PRIMITIVE_TRIANGLE_STRIP or GX_PRIMITIVE_TRIANGLE_FAN
+	 *  - `model_view_projection`: Column-major matrix taking positions to clip space
+	 *  - `model`: Column-major matrix taking positions and normals to the lighting space, nullptr for identity
+	 *  - `shading`: Shading model
+	 *  - `color`: RGBA color, used by vertices without a color attribute
+	 *  - `light_direction`: Direction towards the light in the lighting space
+	 *  - `ambient`: Light received by surfaces facing away from the light, from 0 to 1
+	 *  - `depth_test`: Pixels are kept when nearer than the depth buffer
+	 *  - `depth_write`: Kept pixels write their depth
+	 *  - `cull_back_faces`: Clockwise triangles are discarded
+	 */
+	struct GXSoftwareDraw {
+		const void* vertices;
+		const GXVertexLayout* layout;
+		const uint32_t* indices;
+		size_t count;
+		GXPrimitiveType primitive;
+		const float* model_view_projection;
+		const float* model;
+		GXSoftwareShading shading;
+		float color[4];
+		float light_direction[3];
+		float ambient;
+		bool depth_test, depth_write;
+		bool cull_back_faces;
+	};
+
+	/*! \struct GXSoftwareRenderer
+	 *  \brief CPU triangle rasterizer drawing into its own color and depth buffers, without any OpenGL context.
+	 *
+	 *  Members:
+	 *  - `resource`: Pointer to resource container
+	 *  - `options`: Renderer configuration
+	 *  - `isa`: Instruction set selected for the CPU
+	 *  - `pixels`: RGBA8 color buffer, rows from top to bottom, up to date after gxSoftwareFinish
+	 *  - `depth`: Depth buffer laid out like `pixels`, 0 is the near plane and 1 the far plane
+	 *  - `stride`: Distance between two rows of `pixels` and `depth` in pixels
+	 *  - `triangle_count`: Triangles rasterized since creation, after clipping and culling
+	 *  - `internal`: Internal renderer state
+	 */
+	struct GXSoftwareRenderer {
+		GXResource* resource;
+		GXSoftwareRendererOptions options;
+		GXSoftwareISA isa;
+		const uint32_t* pixels;
+		const float* depth;
+		uint32_t stride;
+		uint64_t triangle_count;
+		void* internal;
+	};
+
+	/*! \struct GXRenderJob
+	 *  \brief Offscreen render requested from a render server.
+	 *
+	 *  Members:
+	 *  - `id`: Job number, counted from 1 since the server started
+	 *  - `width`, `height`: Size of the image in pixels
+	 *  - `output`: Path the image is written to once rendered
+	 *  - `scene`: Scene description given with the job, passed through unchanged
+	 *  - `target`: Bound render target of the job size, its first color attachment is written to `output`
+	 */
+	struct GXRenderJob {
+		uint64_t id;
+		int width, height;
+		const char* output;
+		const char* scene;
+		GXRenderTarget* target;
+	};
+
+	/*! \typedef GXRenderJobCallback
+	 *  \brief Renders the scene of a job into its bound target, returns false to fail the job.
+	 */
+	typedef bool (*GXRenderJobCallback)(const GXRenderJob* job, void* user_data);
+
+	/*! \struct GXRenderServerOptions
+	 *  \brief Render server configuration.
+	 *
+	 *  Members:
+	 *  - `socket_path`: Unix socket accepting clients, nullptr to read jobs from stdin and answer on stdout
+	 *  - `desc`: Formats and sample count of job targets, their size comes from the jobs; 0 formats for GL_RGBA8 and GL_DEPTH24_STENCIL8
+	 *  - `render`: Callback rendering a job
+	 *  - `user_data`: Passed to `render`, keeps programs and assets between jobs
+	 */
+	struct GXRenderServerOptions {
+		const char* socket_path;
+		GXRenderTargetDesc desc;
+		GXRenderJobCallback render;
+		void* user_data;
+	};
+
+	/*! \struct GXRenderServerStats
+	 *  \brief Render server counters, latencies go from receiving a job to its image being written.
+	 *
+	 *  Members:
+	 *  - `jobs_completed`: Jobs rendered and written
+	 *  - `jobs_failed`: Jobs rejected, failed by the callback or whose output could not be written
+	 *  - `jobs_per_second`: Completed jobs over the time from the first job received to the last one finished
+	 *  - `latency_p50_ms`, `latency_p90_ms`, `latency_p99_ms`: Latency percentiles of the last 4096 completed jobs in milliseconds
+	 *  - `latency_max_ms`: Highest latency of a completed job in milliseconds
+	 */
+	struct GXRenderServerStats {
+		uint64_t jobs_completed, jobs_failed;
+		double jobs_per_second;
+		double latency_p50_ms, latency_p90_ms, latency_p99_ms;
+		double latency_max_ms;
+	};
+
+	/*! \struct GXGpuScopeStats
+	 *  \brief GPU time of a profiler scope, aggregated over the samples resolved since the last reset.
+	 *
+	 *  Members:
+	 *  - `name`: Names of the enclosing scopes and of the scope joined by '/' (e.g. "frame/shadows")
+	 *  - `depth`: Number of enclosing scopes
+	 *  - `samples`: Number of resolved samples
+	 *  - `last_ms`: GPU time of the latest resolved sample in milliseconds
+	 *  - `min_ms`, `avg_ms`, `max_ms`: Lowest, average and highest GPU time in milliseconds
+	 */
+	struct GXGpuScopeStats {
+		const char* name;
+		uint32_t depth;
+		uint64_t samples;
+		double last_ms;
+		double min_ms, avg_ms, max_ms;
+	};
+
+
+	/** \fn bool gxAddKeyboardCallback(GXKeyboardCallback cb)
+	 *  \brief Registers a keyboard event callback.
+	 *  \param cb Callback function to register
+	 */
+	GX_API void gxAddKeyboardCallback(GXKeyboardCallback cb);
+
+	/** \fn bool gxClearKeyboardCallback()
+	 *  \brief Clears all keyboard callbacks.
+	 */
+	GX_API void gxClearKeyboardCallback();
+
+	/** \fn void gxDestroyApplication(GXApplication* application)
+	 *  \brief Releases application resources.
+	 *  \param application Application context to destroy
+	 */
+	GX_API void gxDestroyApplication(GXApplication* application);
+
+	/** \fn GXApplication* gxCreateApplication(GXApplicationOptions options)
+	 *  \brief Creates main application context.
+	 *  \param options Configuration flags
+	 *  \return Pointer to application context, nullptr if GX_APP_OPTION_HEADLESS is set and the GLFW null platform
+	 *  could not be initialized.
+	 *  \note Switching between headless and windowed applications reinitializes GLFW.
+	 */
+	GX_API GXApplication* gxCreateApplication(GXApplicationOptions options);
+
+	/** \fn bool gxIsHeadless()
+	 *  \brief Returns whether windows are created as offscreen contexts on the GLFW null platform.
+	 *  \return true if headless, false if otherwise.
+	 */
+	GX_API bool gxIsHeadless();
+
+	/** \fn GXApplication* gxGetApplication()
+	 *  \brief Retrieves current application context.
+	 *  \return Pointer to application context (null if not initialized)
+	 */
+	GX_API GXApplication* gxGetApplication();
+
+	/** \fn void gxExec()
+	 *	\brief Executes the current application.
+	 */
+	GX_API void gxExec();
+
+	/** \fn GXObject* gxAsObject(GXResource* res)
+	 *  \brief Returns a memory pointer to GXObject from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated object
+	 */
+	GX_API GXObject* gxAsObject(GXResource* res);
+
+	/** \fn GXObject* gxCreateStaticObject(uint32_t shader_program, uint32_t vao, uint32_t vbo, uint32_t ebo, void* user_data)
+	 *  \brief Creates and initiatlizes an static GXObject in memory.
+	 *  \param shader_program Shader program id
+	 *  \param vao Vertex array object id
+	 *  \param vbo Vertex buffer object id
+	 *  \param ebo Element buffer object id (optional, can be 0)
+	 *  \param user_data User-defined data pointer (can be null)
+	 *  \return Pointer to object
+	 *  \note All memory is managed by the libary and does not account for the manual freeing of memory outside of its codebase.
+	 */
+	GX_API GXObject* gxCreateObject(uint32_t shader_program, uint32_t vao, uint32_t vbo, uint32_t ebo, void* user_data);
+
+	/** \fn GXObject* gxCreateRenderObject(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data, GXBufferUsageType elem_buffer_usage, size_t elem_size, void* elem_data, void* user_data)
+	 *  \brief Creates and initializes a renderable GXObject in memory.
+	 *  \param shader_program Shader program id
+	 *  \param vert_buffer_usage Buffer usage type for vertex buffer
+	 *  \param vert_size Size of vertex data in bytes
+	 *  \param vert_data Pointer to vertex data (can be null)
+	 *  \param elem_buffer_usage Buffer usage type for element buffer
+	 *  \param elem_size Size of element data in bytes
+	 *  \param elem_data Pointer to element data (can be null)
+	 *  \param user_data User-defined data pointer (can be null)
+	 *  \return Pointer to object
+	 * 
+	 *  \note Requires gxBindObject(...) to be called to ensure it works.
+	 */
+	GX_API GXObject* gxCreateRenderObjectWithElements(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data, GXBufferUsageType elem_buffer_usage, size_t elem_size, void* elem_data, void* user_data);
+
+	/** \fn GXObject* gxCreateRenderObject(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data)
+	 *  \brief Creates and initializes a renderable GXObject in memory without an element buffer.
+	 *  \param shader_program Shader program id
+	 *  \param vert_buffer_usage Buffer usage type for vertex buffer
+	 *  \param vert_size Size of vertex data in bytes
+	 *  \param vert_data Pointer to vertex data (can be null)
+	 *  \param user_data User-defined data pointer (can be null)
+	 *  \return Pointer to object
+	 * 
+	 *  \note Requires gxBindObject(...) to be called to ensure it works.
+	 */
+	GX_API GXObject* gxCreateRenderObject(uint32_t shader_program, GXBufferUsageType vert_buffer_usage, size_t vert_size, void* vert_data, void* user_data);
+
+	/** \fn void gxDrawVertices(GXObject* object, size_t offset, size_t count)
+	 *  \brief Draws a set of vertices from GXObject as triangles.
+	 *  \param object Object pointer
+	 *  \param offset Vertex offset
+	 *  \param count Vertex count
+	 *
+	 *  \see gxDrawPrimitives()
+	 */
+	GX_API void gxDrawVertices(GXObject* object, size_t offset, size_t count);
+
+	/** \fn void gxDrawElements(GXObject* object, size_t offset, size_t count)
+	 *  \brief Draws a set of elements from GXObject as triangles.
+	 *  \param object Object pointer
+	 *  \param count Element count
+	 *  \param type Element type
+	 *
+	 *  \see gxDrawPrimitiveElements()
+	 */
+	GX_API void gxDrawElements(GXObject* object, size_t count, GXVertexAttributeType type);
+
+	/** \fn void gxDrawPrimitives(GXObject* object, GXPrimitiveType primitive, size_t offset, size_t count)
+	 *  \brief Draws a set of vertices from GXObject with the specified primitive topology.
+	 *  \param object Object pointer
+	 *  \param primitive Primitive topology
+	 *  \param offset Vertex offset
+	 *  \param count Vertex count
+	 *
+	 *  \see GXPrimitiveType
+	 */
+	GX_API void gxDrawPrimitives(GXObject* object, GXPrimitiveType primitive, size_t offset, size_t count);
+
+	/** \fn void gxDrawPrimitiveElements(GXObject* object, GXPrimitiveType primitive, size_t count, GXVertexAttributeType type)
+	 *  \brief Draws a set of elements from GXObject with the specified primitive topology.
+	 *  \param object Object pointer
+	 *  \param primitive Primitive topology
+	 *  \param count Element count
+	 *  \param type Element type
+	 *
+	 *  \see GXPrimitiveType
+	 *  \see gxEnablePrimitiveRestart()
+	 */
+	GX_API void gxDrawPrimitiveElements(GXObject* object, GXPrimitiveType primitive, size_t count, GXVertexAttributeType type);
+
+	/** \fn void gxEnablePrimitiveRestart(uint32_t restart_index)
+	 *  \brief Enables primitive restart, an element equal to `restart_index` starts a new strip/fan/loop.
+	 *  \param restart_index Element value that restarts the primitive
+	 *
+	 *  \note Prefer the maximum value of the element type (e.g. 0xFFFF for 16-bit elements), see gxEnablePrimitiveRestartFixedIndex().
+	 */
+	GX_API void gxEnablePrimitiveRestart(uint32_t restart_index);
+
+	/** \fn void gxEnablePrimitiveRestartFixedIndex()
+	 *  \brief Enables primitive restart with the maximum value of the drawn element type as restart index.
+	 */
+	GX_API void gxEnablePrimitiveRestartFixedIndex();
+
+	/** \fn void gxDisablePrimitiveRestart()
+	 *  \brief Disables both kinds of primitive restart.
+	 */
+	GX_API void gxDisablePrimitiveRestart();
+
+	/** \fn size_t gxStripifyTriangles(const uint32_t* indices, size_t index_count, uint32_t restart_index, uint32_t* out_indices, size_t out_capacity)
+	 *  \brief Converts a triangle list into triangle strips joined by a primitive restart index, preserving winding.
+	 *  \param indices Triangle list indices (3 per triangle)
+	 *  \param index_count Number of indices in `indices`
+	 *  \param restart_index Index written between strips
+	 *  \param out_indices Output strip indices (can be null to query the required count)
+	 *  \param out_capacity Capacity of `out_indices` in indices
+	 *  \return Number of indices of the stripified list, or 0 if `out_capacity` is too small.
+	 *
+	 *  The output never exceeds `index_count / 3 * 4` indices, regular grids end up close to 1 index per triangle.
+	 *  Draw the result with gxDrawPrimitiveElements(object, GX_PRIMITIVE_TRIANGLE_STRIP, ...) after enabling primitive restart.
+	 *  Degenerate triangles are dropped.
+	 */
+	GX_API size_t gxStripifyTriangles(const uint32_t* indices, size_t index_count, uint32_t restart_index, uint32_t* out_indices, size_t out_capacity);
+
+	/** \fn void gxBindObject(GXObject* object)
+	 *  \brief Binds all data stored in object, effectively making it work
+	 *  \param object Object pointer
+	 */
+	GX_API void gxBindObject(GXObject* object);
+
+	/** \fn GXWindow* gxAsWindow(GXResource* res)
+	 *  \brief Returns a memory pointer to GXWindow from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated window
+	 */
+	GX_API GXWindow* gxAsWindow(GXResource* res);
+
+	/** \fn GXWindow* gxCreateWindow(bool vsync, bool show, int width, int height, const char* title)
+	 *  \brief Creates and initiatlizes an GXWindow in memory.
+	 *  \param vsync Sync frame rate wuth refresh rate of monitor to prevent "screen tearing"
+	 *  \param show Should the window be shown or hidden after creation
+	 *  \param width The desired width, in screen coordinates, of the window content area
+	 *  \param height The desired height, in screen coordinates, of the window content area
+	 *  \param title The title of the window
+	 *  \return Pointer to window
+	 *  \note In headless mode the window is never visible, its default framebuffer is an offscreen buffer of
+	 *  `width` x `height` pixels and gxExec keeps drawing it while `show` is set, until gxWindowClose is called. Context
+	 *  creation tries OSMesa then EGL, and OpenGL 4.5 when 4.6 is unavailable (Mesa llvmpipe).
+	 *  \note All memory is managed by the libary and does not account for the manual freeing of memory outside of its codebase. Furthermore, events regarding the framebuffer does NOT interrupt drawing, this may be optional in the future.
+	 */
+	GX_API GXWindow* gxCreateWindow(bool vsync, bool show, int width, int height, const char* title);
+
+	/** \fn void gxWindowSetDrawCallback(GXWindow* win, GXDrawCallback cb)
+	 *  \brief Assigns the draw callback for the respective GXWindow.
+	 *  \param win Pointer to window to assign callback to
+	 *  \param cb Callback (GXDrawCallback)
+	 */
+	GX_API void gxWindowSetDrawCallback(GXWindow* win, GXDrawCallback cb);
+
+	/** \fn void gxWindowClose(GXWindow* win)
+	 *  \brief Inidicates to the libary, that the specified window should close.
+	 *  \param win GXWindow to close
+	 */
+	GX_API void gxWindowClose(GXWindow* win);
+
+	/** \fn bool gxWindowShouldClose(GXWindow* win)
+	 *  \brief Returns whether the status of the specified window indicates it should close.
+	 *  \param win The GXWindow to query
+	 *  \return true if the window should close, false if otherwise.
+	 */
+	GX_API bool gxWindowShouldClose(GXWindow* win);
+
+	/** \fn bool gxDestroyResource(GXResource* resource)
+	 *  \brief Destroy and free the specified resource.
+	 *  \param resource The GXResource to destroy
+	 *  \return true if the resource was successfully destroyed, false if it was not (likely due to memory issues).
+	 */
+	GX_API bool gxDestroyResource(GXResource* resource);
+
+	/** \fn void gxUpdateViewport(GXWindow* win)
+	 *  \brief Updates the viewport for a specific window (equivalent to gxViewport(0, 0, win->width, win->height)).
+	 *  \param win The GXWindow to update the viewport for.
+	 * 
+	 *  \note This should only be used in the drawing callback of a window.
+	 *  
+	 *  \see gxViewport()
+	 */
+	GX_API void gxUpdateViewport(GXWindow* win);
+
+	/** \fn void gxSetBackground(float r, float g, float b, float a)
+	 *  \brief Sets the background for the respective graphical context.
+	 *  \param r R/RED channel value ranged between 0.0 to 1.0
+	 *  \param g G/GREEN channel value ranged between 0.0 to 1.0
+	 *  \param b B/BLUE channel value ranged between 0.0 to 1.0
+	 *  \param a A/ALPHA channel value ranged between 0.0 to 1.0
+	 *
+	 * Is the same as doing:
+	 * \code
+	 * gxClearColor(r, g, b, a);
+	 * gxClearColorBuffer();
+	 * \endcode
+	 *
+	 * \see gxClearColor()
+	 * \see gxClearColorBuffer()
+	 */
+	GX_API void gxSetBackground(float r, float g, float b, float a);
+
+	/** \fn void gxViewport(int x, int y, int w, int h)
+	 *  \brief Sets the viewport for the respective graphical context.
+	 *  \param x Viewport x position
+	 *  \param y Viewport y position
+	 *  \param w Viewport width
+	 *  \param h Viewport height
+	 *
+	 *  \note This is the same as glViewport, and simply a wrapper to allow easier binding implementation.
+	 */
+	GX_API void gxViewport(int x, int y, int w, int h);
+
+	/** \fn void gxClearColor(float r, float g, float b, float a)
+	 *  \brief Sets the clear color for the respective graphical context.
+	 *  \param r R/RED channel value ranged between 0.0 to 1.0
+	 *  \param g G/GREEN channel value ranged between 0.0 to 1.0
+	 *  \param b B/BLUE channel value ranged between 0.0 to 1.0
+	 *  \param a A/ALPHA channel value ranged between 0.0 to 1.0
+	 *
+	 *  \note This is the same as glClearColor(...), and simply a wrapper to allow easier binding implementation.
+	 */
+	GX_API void gxClearColor(float r, float g, float b, float a);
+
+	/** \fn void gxClear(unsigned int bit)
+	 *  \brief Sets the bitplane area for the respective graphical context.
+	 *  \param bit GXBufferBit
+	 *
+	 *  \note This is the same as glClear(...), and simply a wrapper to allow easier binding implementation.
+	 *
+	 *  \see GXBufferBit
+	 */
 	GX_API void gxClear(unsigned int bit);
 
-	/** \fn GXShaderCompilationResult gxCompileGLSLShader(const char* shader_src, GXShaderType shader_type)
-	 *  \brief Compiles a GLSL shader from source code.
-	 *  \param shader_src Source code of the shader
-	 *  \param shader_type Type of the shader (vertex or fragment)
-	 *  \return Compilation result.
-	 * 
-	 *  \see GXShaderType
-	 *  \see GXShaderCompilationResult
+	/** \fn GXShaderCompilationResult gxCompileGLSLShader(const char* shader_src, GXShaderType shader_type)
+	 *  \brief Compiles a GLSL shader from source code.
+	 *  \param shader_src Source code of the shader
+	 *  \param shader_type Type of the shader (vertex or fragment)
+	 *  \return Compilation result.
+	 * 
+	 *  \see GXShaderType
+	 *  \see GXShaderCompilationResult
+	 */
+	GX_API GXShaderCompilationResult gxCompileGLSLShader(const char* shader_src, GXShaderType shader_type);
+	
+	/** \fn GXProgramCompilationResult gxCompileGLSLProgram(const char* vertex_shader_src, const char* fragment_shader_src)
+	 *  \brief Compiles a GLSL vertex and fragment shader from source code.
+	 *  \param vertex_shader_src Source code of the vertex shader
+	 *  \param fragment_shader_src Source code of the fragment shader
+	 *  \return Compilation result.
+	 * 
+	 *  \see GXProgramCompilationResult
+	 */
+	GX_API GXProgramCompilationResult gxCompileGLSLProgram(const char* vertex_shader_src, const char* fragment_shader_src);
+
+	/** \fn uint32_t gxGenVertexArrayObject()
+	 *  \brief Generates a new Vertex Array Object (VAO).
+	 *  \return Vertex Array Object (VAO) id.
+	 */
+	GX_API uint32_t gxGenVertexArrayObject();
+
+	/** \fn void gxBindVertexArrayObject(uint32_t vao)
+	 *  \brief Binds a Vertex Array Object (VAO) for use.
+	 *  \param vao Vertex array object (VAO) id to bind
+	 */
+	GX_API void gxBindVertexArrayObject(uint32_t vao);
+
+	/** \fn uint32_t gxGenBufferObject(GXBufferType buffer_type, GXBufferUsageType buffer_usage, size_t size, void* data)
+	 *  \brief Generates a new (Array/Element Array) Buffer Object.
+	 *  \param buffer_type Type of buffer
+	 *  \param buffer_usage Buffer usage type
+	 *  \param size Size of	`data`
+	 *  \param data Data to place in buffer
+	 *  \returns (Array/Element Array) Buffer Object id
+	 * 
+	 *  \see GXBufferType
+	 *  \see GXBufferUsageType
+	 */
+	GX_API uint32_t gxGenBufferObject(GXBufferType buffer_type, GXBufferUsageType buffer_usage, size_t size, void* data);
+
+	/** \fn void gxBindBufferObject(GXBufferType buffer_type, uint32_t buffer)
+	 *  \brief Binds a (Array/Element Array) Buffer Object for use.
+	 *  \param buffer_type Type of buffer
+	 *  \param buffer (Array/Element Array) Buffer Object id
+	 * 
+	 *  \see GXBufferType
+	 */
+	GX_API void gxBindBufferObject(GXBufferType buffer_type, uint32_t buffer);
+
+	/** \fn void* gxMapBufferRange(GXBufferType buffer_type, size_t offset, size_t length, GXMappingBits bits)
+	 *  \brief Maps a range of a (Array/Element Array) Buffer Object to CPU memory, allowing access (based of `bits`).
+	 *  \param buffer_type Type of buffer to map
+	 *  \param offset Offset in bytes from the start of the buffer
+	 *  \param length Length in bytes of the range to map
+	 *  \param bits Mapping bits that control how the buffer is accessed
+	 *  \return Pointer to the mapped buffer range, or `nullptr` (or its respective alternative) on failure.
+	 * 
+	 *  \note This is equivalent to glMapBufferRange, and simply a wrapper to allow easier binding implementation.
+	 */
+	GX_API void* gxMapBufferRange(GXBufferType buffer_type, size_t offset, size_t length, GXMappingBits bits);
+
+	/** \fn void gxUnmapBuffer(GXBufferType buffer_type)
+	 *  \brief Unmaps a previously mapped (Array/Element Array) Buffer Object.
+	 *  \param buffer_type Type of buffer to unmap
+	 *  \return true if the buffer was successfully unmapped, false if it was not (likely due to memory issues).
+	 *
+	 *  \note This is equivalent to glUnmapBuffer, and simply a wrapper to allow easier binding implementation.
+	 */
+	GX_API bool gxUnmapBuffer(GXBufferType buffer_type);
+
+	/** \fn void gxBufferData(GXBufferType buffer_type, size_t size, void* data, GXBufferUsageType usage)
+	 *  \brief Allocates and initializes a (Array/Element Array) Buffer Object with data.
+	 *  \param buffer_type Type of buffer to allocate
+	 *  \param size Size of the buffer in bytes
+	 *  \param data Data to initialize the buffer with
+	 *  \param usage Buffer usage type
+	 *
+	 *  \note This is equivalent to glBufferSubData, and simply a wrapper to allow easier binding implementation.
+	 */
+	GX_API void gxBufferSubData(GXBufferType buffer_type, size_t offset, size_t length, void* data);
+
+	/** \fn bool gxUpdateBufferObject(GXBufferType type, uint32_t bo, size_t offset, size_t length, void* data)
+	 *  \brief Updates data in a (Array/Element Array/Uniform) Buffer Object.
+	 *  \param type Type of buffer to update
+	 *  \param bo Buffer Object id to update
+	 *  \param offset Offset in bytes from the start of the buffer
+	 *  \param length Length in bytes of the data to update
+	 *  \param data Pointer to the new data
+	 *  \return true if the buffer was successfully updated, false if it was not (likely due to memory issues).
+	 */
+	GX_API bool gxUpdateBufferObject(GXBufferType type, uint32_t bo, size_t offset, size_t length, void* data);
+
+	/** \fn void gxUpdateVertices(GXObject* object, size_t offset, size_t length, void* data)
+	 *  \brief Updates the vertex data of a GXObject.
+	 *  \param object Pointer to the GXObject to update
+	 *  \param offset Offset in bytes from the start of the vertex buffer
+	 *  \param length Length in bytes of the data to update
+	 *  \param data Pointer to the new vertex data
+	 *  \return true if the vertices were successfully updated, false if it was not (likely due to memory issues).
+	 *
+	 */
+	GX_API bool gxUpdateVertices(GXObject* object, size_t offset, size_t length, void* data);
+
+	/** \fn bool gxUpdateElements(GXObject* object, size_t offset, size_t length, void* data)
+	 *  \brief Updates the index data of a GXObject.
+	 *  \param object Pointer to the GXObject to update
+	 *  \param offset Offset in bytes from the start of the element buffer
+	 *  \param length Length in bytes of the data to update
+	 *  \param data Pointer to the new index data
+	 *  \return true if the elements were successfully updated, false if it was not (likely due to memory issues).
+	 * 
+	 */
+	GX_API bool gxUpdateElements(GXObject* object, size_t offset, size_t length, void* data);
+
+	/** \fn bool gxUpdateUniformBlock(uint32_t ubo, size_t offset, size_t length, void* data)
+	 *  \brief Updates the index data of a GXObject.
+	 *  \param ubo Uniform Buffer Object id to update
+	 *  \param offset Offset in bytes from the start of the uniform buffer
+	 *  \param length Length in bytes of the data to update
+	 *  \param data Pointer to the new index data
+	 *  \return true if the uniforms were successfully updated, false if it was not (likely due to memory issues).
+	 *
+	 */
+	GX_API bool gxUpdateUniformBlock(uint32_t ubo, size_t offset, size_t length, void* data);
+
+	/** \fn void gxSetVertexAttribute(GXObject* object, uint32_t index, int size, GXVertexAttributeType type, bool normalize, size_t stride, void* pointer)
+	 *  \brief Sets a vertex attribute for a GXObject.
+	 *  \param object Pointer to the GXObject to set the attribute for
+	 *  \param index Index of the vertex attribute
+	 *  \param size Number of components per vertex attribute (1, 2, 3, or 4)
+	 *  \param type Data type of the vertex attribute (e.g., float, int)
+	 *  \param normalize Whether to normalize the vertex attribute data
+	 *  \param stride Byte offset between consecutive vertex attributes
+	 *  \param pointer Pointer to the vertex attribute data in the buffer
+	 *  
+	 *  \see GXVertexAttributeType
+	 */
+	GX_API void gxSetVertexAttribute(GXObject* object, uint32_t index, int size, GXVertexAttributeType type, bool normalize, size_t stride, void* pointer);
+
+	/** \fn void gxEnableVertexAttribute(GXObject* object, uint32_t index)
+	 *  \brief Enables a vertex attribute for a GXObject.
+	 *  \param object Pointer to the GXObject to enable the attribute for
+	 *  \param index Index of the vertex attribute to enable
+	 */
+	GX_API void gxEnableVertexAttribute(GXObject* object, uint32_t index);
+
+	/** \fn void gxDisableVertexAttribute(GXObject* object, uint32_t index)
+	 *  \brief Disables a vertex attribute for a GXObject.
+	 *  \param object Pointer to the GXObject to disable the attribute for
+	 *  \param index Index of the vertex attribute to disable
+	 */
+	GX_API void gxDisableVertexAttribute(GXObject* object, uint32_t index);
+
+	/** \fn void gxBindBufferBase(GXBufferType type, uint32_t binding_point, uint32_t bo)
+	 *  \brief Binds a Buffer Object to a specific binding point.
+	 *  \param type Type of buffer to bind (e.g., uniform, array)
+	 *  \param binding_point Binding point index to bind the buffer to
+	 *  \param bo Buffer Object id to bind
+	 */
+	GX_API void gxBindBufferBase(GXBufferType type, uint32_t binding_point, uint32_t bo);
+
+	/** \fn void gxBindUniformBlock(uint32_t binding_point, uint32_t ubo)
+	 *  \brief Binds a Uniform Block to a specific binding point for a shader.
+	 *  \param binding_point Binding point index to bind the buffer to
+	 *  \param ubo Uniform Buffer Object id to bind
+	 */
+	GX_API void gxBindUniformBlock(uint32_t binding_point, uint32_t ubo);
+
+	/** \fn void gxUseShader(GXObject* object)
+	 *  \brief Tells the program to use the shader associated with the object.
+	 *  \param object Pointer to GXObject and therefore its shader
+	 */
+	GX_API void gxUseShader(GXObject* object);
+
+	/** \fn GXProgramCompilationResult gxCompileGLSLComputeProgram(const char* compute_shader_src)
+	 *  \brief Compiles a GLSL compute shader from source code and links it into a program.
+	 *  \param compute_shader_src Source code of the compute shader
+	 *  \return Compilation result, `compute_result` holds the shader compilation result.
+	 *
+	 *  \see GXProgramCompilationResult
+	 */
+	GX_API GXProgramCompilationResult gxCompileGLSLComputeProgram(const char* compute_shader_src);
+
+	/** \fn void gxExtractFrustumPlanes(const float* view_projection, float* planes)
+	 *  \brief Extracts the 6 normalized frustum planes of a view-projection matrix.
+	 *  \param view_projection Column-major 4x4 view-projection matrix (16 floats)
+	 *  \param planes Output array of 24 floats, laid out as left, right, bottom, top, near, far planes (`xyz` normal, `w` distance)
+	 */
+	GX_API void gxExtractFrustumPlanes(const float* view_projection, float* planes);
+
+	/** \fn GXCullingStage* gxAsCullingStage(GXResource* res)
+	 *  \brief Returns a memory pointer to GXCullingStage from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated culling stage
+	 */
+	GX_API GXCullingStage* gxAsCullingStage(GXResource* res);
+
+	/** \fn GXCullingStage* gxCreateCullingStage(GXObject* object, GXBoundsType bounds_type, uint32_t capacity, uint32_t count, GXVertexAttributeType element_type, uint32_t visible_binding)
+	 *  \brief Creates a GPU culling stage that draws up to `capacity` instances of `object`.
+	 *  \param object Object to draw, it is drawn with glDrawElementsIndirect if it has an element buffer, otherwise glDrawArraysIndirect
+	 *  \param bounds_type Bounding volume type used for every instance
+	 *  \param capacity Maximum number of instances
+	 *  \param count Vertex (or element) count of a single instance
+	 *  \param element_type Element type (ignored if `object` has no element buffer)
+	 *  \param visible_binding Shader storage binding point of the visible instance indices in the objects shader
+	 *  \return Pointer to culling stage, or nullptr on failure
+	 *
+	 *  The culling pass writes the index of every visible instance into a compacted array, the vertex shader of `object`
+	 *  is expected to fetch its per-instance data through it:
+	 *  \code
+	 *  layout(std430, binding = 1) readonly buffer GXVisibleInstances { uint gx_visible_instances[]; };
+	 *  ...
+	 *  uint instance = gx_visible_instances[gl_InstanceID];
+	 *  \endcode
+	 *
+	 *  \note All memory is managed by the libary and does not account for the manual freeing of memory outside of its codebase.
+	 */
+	GX_API GXCullingStage* gxCreateCullingStage(GXObject* object, GXBoundsType bounds_type, uint32_t capacity, uint32_t count, GXVertexAttributeType element_type, uint32_t visible_binding);
+
+	/** \fn bool gxUpdateCullingBounds(GXCullingStage* stage, uint32_t first, uint32_t count, const GXInstanceBounds* bounds)
+	 *  \brief Uploads the bounds of a range of instances, instances outside of the range keep their previous bounds.
+	 *  \param stage Culling stage to update
+	 *  \param first Index of the first instance to update
+	 *  \param count Number of instances to update
+	 *  \param bounds Bounds of the instances
+	 *  \return true if the bounds were updated, false if the range exceeds the stages capacity.
+	 *
+	 *  \note The instance count of the stage is grown to include the updated range.
+	 */
+	GX_API bool gxUpdateCullingBounds(GXCullingStage* stage, uint32_t first, uint32_t count, const GXInstanceBounds* bounds);
+
+	/** \fn void gxSetCullingInstanceCount(GXCullingStage* stage, uint32_t instance_count)
+	 *  \brief Sets the number of instances tested by the next gxDispatchCulling (clamped to the stages capacity).
+	 *  \param stage Culling stage
+	 *  \param instance_count Number of instances
+	 */
+	GX_API void gxSetCullingInstanceCount(GXCullingStage* stage, uint32_t instance_count);
+
+	/** \fn void gxDispatchCulling(GXCullingStage* stage, const float* view_projection)
+	 *  \brief Frustum tests every instance on the GPU and writes the visible ones into the stages indirect draw command.
+	 *  \param stage Culling stage
+	 *  \param view_projection Column-major 4x4 view-projection matrix (16 floats)
+	 *
+	 *  \note This changes the active program, the CPU cost is constant regardless of the instance count.
+	 */
+	GX_API void gxDispatchCulling(GXCullingStage* stage, const float* view_projection);
+
+	/** \fn void gxDrawCulled(GXCullingStage* stage)
+	 *  \brief Draws the instances that passed the last gxDispatchCulling with a single indirect draw call.
+	 *  \param stage Culling stage
+	 *
+	 *  \note This uses the shader program of the stages object.
+	 */
+	GX_API void gxDrawCulled(GXCullingStage* stage);
+
+	/** \fn GXCommandList* gxAsCommandList(GXResource* res)
+	 *  \brief Returns a memory pointer to GXCommandList from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated command list
+	 */
+	GX_API GXCommandList* gxAsCommandList(GXResource* res);
+
+	/** \fn GXCommandList* gxCreateCommandList()
+	 *  \brief Creates an empty command list.
+	 *  \return Pointer to command list
+	 *
+	 *  Command lists do not touch GL while recording, so every worker thread can record into its own list.
+	 *  A single list must only be recorded by one thread at a time.
+	 *  \code
+	 *  // worker threads
+	 *  gxCmdUseShader(lists[thread], object);
+	 *  gxCmdDrawPrimitives(lists[thread], object, GX_PRIMITIVE_TRIANGLES, 0, 3);
+	 *  // GL thread, after joining the workers
+	 *  gxExecuteCommandLists(lists, thread_count);
+	 *  \endcode
+	 *
+	 *  \note Creation and destruction must happen on the thread owning the GL context.
+	 */
+	GX_API GXCommandList* gxCreateCommandList();
+
+	/** \fn void gxResetCommandList(GXCommandList* list)
+	 *  \brief Removes every recorded command while keeping the lists memory for reuse.
+	 *  \param list Command list to reset
+	 */
+	GX_API void gxResetCommandList(GXCommandList* list);
+
+	/** \fn void gxCmdUseShader(GXCommandList* list, GXObject* object)
+	 *  \brief Records gxUseShader(object).
+	 */
+	GX_API void gxCmdUseShader(GXCommandList* list, GXObject* object);
+
+	/** \fn void gxCmdUseProgram(GXCommandList* list, uint32_t program)
+	 *  \brief Records the activation of a shader program (0 unbinds).
+	 */
+	GX_API void gxCmdUseProgram(GXCommandList* list, uint32_t program);
+
+	/** \fn void gxCmdDrawPrimitives(GXCommandList* list, GXObject* object, GXPrimitiveType primitive, size_t offset, size_t count)
+	 *  \brief Records gxDrawPrimitives(object, primitive, offset, count).
+	 */
+	GX_API void gxCmdDrawPrimitives(GXCommandList* list, GXObject* object, GXPrimitiveType primitive, size_t offset, size_t count);
+
+	/** \fn void gxCmdDrawPrimitiveElements(GXCommandList* list, GXObject* object, GXPrimitiveType primitive, size_t count, GXVertexAttributeType type)
+	 *  \brief Records gxDrawPrimitiveElements(object, primitive, count, type).
+	 */
+	GX_API void gxCmdDrawPrimitiveElements(GXCommandList* list, GXObject* object, GXPrimitiveType primitive, size_t count, GXVertexAttributeType type);
+
+	/** \fn void gxCmdBindBufferBase(GXCommandList* list, GXBufferType type, uint32_t binding_point, uint32_t bo)
+	 *  \brief Records gxBindBufferBase(type, binding_point, bo).
+	 */
+	GX_API void gxCmdBindBufferBase(GXCommandList* list, GXBufferType type, uint32_t binding_point, uint32_t bo);
+
+	/** \fn void gxCmdSetUniform(GXCommandList* list, uint32_t program, int location, GXUniformType type, int count, const void* data)
+	 *  \brief Records a uniform write, `data` is copied into the list.
+	 *  \param list Command list
+	 *  \param program Shader program the uniform belongs to
+	 *  \param location Uniform location
+	 *  \param type Uniform data type
+	 *  \param count Number of array elements to write
+	 *  \param data Uniform data (`count` elements of `type`)
+	 *
+	 *  \note Uniforms are written with glProgramUniform*, so the program does not have to be active when replaying.
+	 */
+	GX_API void gxCmdSetUniform(GXCommandList* list, uint32_t program, int location, GXUniformType type, int count, const void* data);
+
+	/** \fn void gxCmdUpdateBuffer(GXCommandList* list, uint32_t bo, size_t offset, size_t length, const void* data)
+	 *  \brief Records a buffer update, `data` is copied into the list.
+	 *  \param list Command list
+	 *  \param bo Buffer Object id to update
+	 *  \param offset Offset in bytes from the start of the buffer
+	 *  \param length Length in bytes of the data to update
+	 *  \param data Pointer to the new data
+	 */
+	GX_API void gxCmdUpdateBuffer(GXCommandList* list, uint32_t bo, size_t offset, size_t length, const void* data);
+
+	/** \fn void gxCmdViewport(GXCommandList* list, int x, int y, int w, int h)
+	 *  \brief Records gxViewport(x, y, w, h).
+	 */
+	GX_API void gxCmdViewport(GXCommandList* list, int x, int y, int w, int h);
+
+	/** \fn void gxCmdClearColor(GXCommandList* list, float r, float g, float b, float a)
+	 *  \brief Records gxClearColor(r, g, b, a).
+	 */
+	GX_API void gxCmdClearColor(GXCommandList* list, float r, float g, float b, float a);
+
+	/** \fn void gxCmdClear(GXCommandList* list, unsigned int bit)
+	 *  \brief Records gxClear(bit).
+	 */
+	GX_API void gxCmdClear(GXCommandList* list, unsigned int bit);
+
+	/** \fn void gxExecuteCommandLists(GXCommandList** lists, size_t count)
+	 *  \brief Replays the commands of every list in order, lists are replayed in array order.
+	 *  \param lists Command lists to replay
+	 *  \param count Number of command lists
+	 *
+	 *  \note This must be used on the thread owning the GL context, and not while any of the lists is being recorded.
+	 *  Redundant program changes between consecutive commands are skipped.
+	 */
+	GX_API void gxExecuteCommandLists(GXCommandList** lists, size_t count);
+
+	/** \fn GXRenderBundle* gxAsRenderBundle(GXResource* res)
+	 *  \brief Returns a memory pointer to GXRenderBundle from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated render bundle
+	 */
+	GX_API GXRenderBundle* gxAsRenderBundle(GXResource* res);
+
+	/** \fn GXRenderBundle* gxCreateRenderBundle(GXCommandList* list, GXBundleOptions options)
+	 *  \brief Compiles the commands recorded in `list` into a render bundle.
+	 *  \param list Command list holding the recorded commands, it can be reset or destroyed afterwards
+	 *  \param options Compilation flags
+	 *  \return Pointer to render bundle
+	 *
+	 *  Compilation removes state changes that do not change anything (program, buffer bindings, viewport,
+	 *  clear color and repeated uniform values), optionally sorts draws, and merges consecutive draws sharing
+	 *  program, vertex array and primitive into a single glMultiDraw*Indirect call.
+	 *
+	 *  \note The bundle is invalidated once an object it draws is destroyed, see GXRenderBundle::valid.
+	 */
+	GX_API GXRenderBundle* gxCreateRenderBundle(GXCommandList* list, GXBundleOptions options);
+
+	/** \fn bool gxExecuteBundle(GXRenderBundle* bundle)
+	 *  \brief Replays a render bundle.
+	 *  \param bundle Render bundle to replay
+	 *  \return true if the bundle was replayed, false if it is invalid.
+	 */
+	GX_API bool gxExecuteBundle(GXRenderBundle* bundle);
+
+	/** \fn void gxOrthographicProjection(float* out, float left, float right, float bottom, float top, float near_plane, float far_plane)
+	 *  \brief Writes a column-major orthographic projection matrix.
+	 *  \param out Output array of 16 floats
+	 *  \param left Left clipping plane
+	 *  \param right Right clipping plane
+	 *  \param bottom Bottom clipping plane
+	 *  \param top Top clipping plane
+	 *  \param near_plane Near clipping plane
+	 *  \param far_plane Far clipping plane
+	 *
+	 *  \code
+	 *  // Pixel coordinates with the origin in the top left corner of `window`
+	 *  gxOrthographicProjection(projection, 0.0f, (float)window->width, (float)window->height, 0.0f, -1.0f, 1.0f);
+	 *  \endcode
+	 */
+	GX_API void gxOrthographicProjection(float* out, float left, float right, float bottom, float top, float near_plane, float far_plane);
+
+	/** \fn GXSpriteBatch* gxAsSpriteBatch(GXResource* res)
+	 *  \brief Returns a memory pointer to GXSpriteBatch from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated sprite batch
+	 */
+	GX_API GXSpriteBatch* gxAsSpriteBatch(GXResource* res);
+
+	/** \fn GXSpriteBatch* gxCreateSpriteBatch(uint32_t capacity, GXSpriteSortMode sort_mode)
+	 *  \brief Creates a sprite batch and its built-in shader, streaming vertex buffer and static element buffer.
+	 *  \param capacity Maximum number of sprites per flush
+	 *  \param sort_mode Order of the queued sprites
+	 *  \return Pointer to sprite batch, or nullptr on failure
+	 *
+	 *  Custom sprite shaders receive `layout(location = 0) in vec2` position, `layout(location = 1) in vec2` texture coordinates,
+	 *  `layout(location = 2) in vec4` color, the projection as `layout(location = 0) uniform mat4` and the texture on binding 0.
+	 */
+	GX_API GXSpriteBatch* gxCreateSpriteBatch(uint32_t capacity, GXSpriteSortMode sort_mode);
+
+	/** \fn void gxSpriteBatchBegin(GXSpriteBatch* batch, const float* projection)
+	 *  \brief Starts a new batch, discarding sprites that were not flushed.
+	 *  \param batch Sprite batch
+	 *  \param projection Column-major 4x4 projection matrix (null for identity)
+	 */
+	GX_API void gxSpriteBatchBegin(GXSpriteBatch* batch, const float* projection);
+
+	/** \fn void gxSpriteBatchDraw(GXSpriteBatch* batch, const GXSprite* sprites, size_t count)
+	 *  \brief Queues sprites, the batch is flushed automatically when it reaches its capacity.
+	 *  \param batch Sprite batch
+	 *  \param sprites Sprites to queue
+	 *  \param count Number of sprites
+	 */
+	GX_API void gxSpriteBatchDraw(GXSpriteBatch* batch, const GXSprite* sprites, size_t count);
+
+	/** \fn void gxSpriteBatchEnd(GXSpriteBatch* batch)
+	 *  \brief Flushes every queued sprite.
+	 *  \param batch Sprite batch
+	 *
+	 *  All queued vertices are written with a single buffer mapping, followed by one draw per shader/texture run.
+	 */
+	GX_API void gxSpriteBatchEnd(GXSpriteBatch* batch);
+
+	/** \fn void gxDebugSetViewProjection(const float* view_projection)
+	 *  \brief Sets the view-projection matrix used to flush debug primitives.
+	 *  \param view_projection Column-major 4x4 view-projection matrix (16 floats)
+	 */
+	GX_API void gxDebugSetViewProjection(const float* view_projection);
+
+	/** \fn void gxDebugPoint(const float* position, uint32_t color, GXDebugDrawFlags flags, float duration)
+	 *  \brief Queues a debug point.
+	 *  \param position Point position (3 floats)
+	 *  \param color Packed RGBA8 color (red in the lowest byte)
+	 *  \param flags Debug drawing flags
+	 *  \param duration Time in seconds the point stays visible, 0 for the current frame only
+	 */
+	GX_API void gxDebugPoint(const float* position, uint32_t color, GXDebugDrawFlags flags, float duration);
+
+	/** \fn void gxDebugLine(const float* from, const float* to, uint32_t color, GXDebugDrawFlags flags, float duration)
+	 *  \brief Queues a debug line segment.
+	 *  \param from Start position (3 floats)
+	 *  \param to End position (3 floats)
+	 *  \param color Packed RGBA8 color (red in the lowest byte)
+	 *  \param flags Debug drawing flags
+	 *  \param duration Time in seconds the line stays visible, 0 for the current frame only
+	 *
+	 *  \note A primitive with a duration is drawn by the window whose draw callback queued it. Queued outside a draw
+	 *  callback (during setup or from an input callback), it belongs to the first window flushed afterwards.
+	 */
+	GX_API void gxDebugLine(const float* from, const float* to, uint32_t color, GXDebugDrawFlags flags, float duration);
+
+	/** \fn void gxDebugBox(const float* center, const float* half_extents, uint32_t color, GXDebugDrawFlags flags, float duration)
+	 *  \brief Queues the 12 edges of an axis aligned box.
+	 *  \param center Box center (3 floats)
+	 *  \param half_extents Box half extents (3 floats)
+	 *  \param color Packed RGBA8 color (red in the lowest byte)
+	 *  \param flags Debug drawing flags
+	 *  \param duration Time in seconds the box stays visible, 0 for the current frame only
+	 *  \note Boxes with a duration follow the same window rule as gxDebugLine.
+	 */
+	GX_API void gxDebugBox(const float* center, const float* half_extents, uint32_t color, GXDebugDrawFlags flags, float duration);
+
+	/** \fn void gxDebugSphere(const float* center, float radius, uint32_t color, GXDebugDrawFlags flags, float duration)
+	 *  \brief Queues a sphere as 3 axis aligned circles.
+	 *  \param center Sphere center (3 floats)
+	 *  \param radius Sphere radius
+	 *  \param color Packed RGBA8 color (red in the lowest byte)
+	 *  \param flags Debug drawing flags
+	 *  \param duration Time in seconds the sphere stays visible, 0 for the current frame only
+	 */
+	GX_API void gxDebugSphere(const float* center, float radius, uint32_t color, GXDebugDrawFlags flags, float duration);
+
+	/** \fn void gxDebugArrow(const float* from, const float* to, uint32_t color, GXDebugDrawFlags flags, float duration)
+	 *  \brief Queues an arrow pointing from `from` to `to`.
+	 *  \param from Arrow tail (3 floats)
+	 *  \param to Arrow head (3 floats)
+	 *  \param color Packed RGBA8 color (red in the lowest byte)
+	 *  \param flags Debug drawing flags
+	 *  \param duration Time in seconds the arrow stays visible, 0 for the current frame only
+	 */
+	GX_API void gxDebugArrow(const float* from, const float* to, uint32_t color, GXDebugDrawFlags flags, float duration);
+
+	/** \fn void gxDebugFlush()
+	 *  \brief Draws every queued debug primitive into the current context and clears the per-frame queue.
+	 *
+	 *  All primitives are uploaded with a single buffer update and drawn with one draw per primitive type and depth mode.
+	 *  \note gxExec calls this after each GXDrawCallback, primitives queued with a duration are only drawn into the window that was being drawn when they were queued.
+	 */
+	GX_API void gxDebugFlush();
+
+	/** \fn void gxDebugClear()
+	 *  \brief Removes every queued debug primitive, including the ones with a remaining duration.
+	 */
+	GX_API void gxDebugClear();
+
+	/** \fn bool gxEnableProgramCache(const char* directory)
+	 *  \brief Enables the on-disk program binary cache for gxCompileGLSLProgram and gxCompileGLSLComputeProgram.
+	 *  \param directory Cache directory, created if it does not exist. Passing `nullptr` disables the cache.
+	 *  \return true if the cache is enabled.
+	 *
+	 *  \note Binaries are keyed by a hash of every stage and its source together with GL_VENDOR, GL_RENDERER
+	 *  and GL_VERSION, so a driver update never loads a stale binary. A binary the driver refuses is deleted
+	 *  and the program is compiled from source again.
+	 *  \note Programs must be compiled with a current context. The cache is disabled by default.
+	 *  \note The cache can be moved or disabled while asynchronous compiles are running, compiles already started
+	 *  keep using the directory they began with.
+	 *
+	 *  \see gxGetProgramCacheStats
+	 */
+	GX_API bool gxEnableProgramCache(const char* directory);
+
+	/** \fn GXProgramCacheStats gxGetProgramCacheStats()
+	 *  \brief Returns the statistics of the program binary cache since it was enabled or last reset.
+	 *  \return Cache statistics.
+	 *
+	 *  \see GXProgramCacheStats
+	 */
+	GX_API GXProgramCacheStats gxGetProgramCacheStats();
+
+	/** \fn void gxResetProgramCacheStats()
+	 *  \brief Resets the statistics of the program binary cache.
+	 */
+	GX_API void gxResetProgramCacheStats();
+
+	/** \fn GXPendingProgram* gxAsPendingProgram(GXResource* res)
+	 *  \brief Returns a memory pointer to GXPendingProgram from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated pending program
+	 */
+	GX_API GXPendingProgram* gxAsPendingProgram(GXResource* res);
+
+	/** \fn GXPendingProgram* gxCompileGLSLProgramAsync(const char* vertex_shader_src, const char* fragment_shader_src)
+	 *  \brief Starts compiling and linking a GLSL vertex and fragment shader without waiting for the result.
+	 *  \param vertex_shader_src Source code of the vertex shader
+	 *  \param fragment_shader_src Source code of the fragment shader
+	 *  \return Pointer to pending program, nullptr if no context is current.
+	 *
+	 *  With GL_KHR_parallel_shader_compile (or GL_ARB_parallel_shader_compile) the driver compiles on its own threads
+	 *  and completion is queried with GL_COMPLETION_STATUS_KHR. Otherwise the program is compiled by worker threads
+	 *  owning hidden contexts shared with the current context.
+	 *
+	 *  \note The program belongs to the caller once GXPendingProgram::ready is set; destroying the pending program
+	 *  before that deletes it. Poll from a context sharing objects with the one current here.
+	 *
+	 *  \see gxPollProgram
+	 *  \see gxWaitProgram
+	 */
+	GX_API GXPendingProgram* gxCompileGLSLProgramAsync(const char* vertex_shader_src, const char* fragment_shader_src);
+
+	/** \fn size_t gxCompileGLSLProgramsAsync(const GXProgramSources* sources, size_t count, GXPendingProgram** out_programs)
+	 *  \brief Starts compiling and linking `count` programs without waiting for any of them.
+	 *  \param sources Program sources
+	 *  \param count Number of programs
+	 *  \param out_programs Output array receiving `count` pending programs
+	 *  \return Number of programs started, entries that could not be started are set to nullptr.
+	 *
+	 *  \note Every shader is submitted before any program is linked, so the driver can compile all of them in parallel.
+	 *
+	 *  \see gxCompileGLSLProgramAsync
+	 */
+	GX_API size_t gxCompileGLSLProgramsAsync(const GXProgramSources* sources, size_t count, GXPendingProgram** out_programs);
+
+	/** \fn bool gxPollProgram(GXPendingProgram* program)
+	 *  \brief Checks whether a pending program finished without blocking.
+	 *  \param program Pending program
+	 *  \return true if the program is ready, GXPendingProgram::result then holds the compilation result.
+	 */
+	GX_API bool gxPollProgram(GXPendingProgram* program);
+
+	/** \fn size_t gxPollPrograms(GXPendingProgram** programs, size_t count)
+	 *  \brief Polls every pending program once without blocking.
+	 *  \param programs Pending programs, nullptr entries are skipped
+	 *  \param count Number of pending programs
+	 *  \return Number of ready programs.
+	 */
+	GX_API size_t gxPollPrograms(GXPendingProgram** programs, size_t count);
+
+	/** \fn GXProgramCompilationResult gxWaitProgram(GXPendingProgram* program)
+	 *  \brief Blocks until a pending program finished.
+	 *  \param program Pending program
+	 *  \return Compilation result.
+	 */
+	GX_API GXProgramCompilationResult gxWaitProgram(GXPendingProgram* program);
+
+	/** \fn bool gxWatchShaderFiles(GXObject* object, const char* vertex_shader_path, const char* fragment_shader_path)
+	 *  \brief Recompiles the program of `object` whenever one of its shader files changes.
+	 *  \param object Object whose GXObject::shader_program is replaced
+	 *  \param vertex_shader_path Path of the vertex shader source file
+	 *  \param fragment_shader_path Path of the fragment shader source file
+	 *  \return true if the files are being watched.
+	 *
+	 *  Changes are detected with inotify on Linux and by polling modification times elsewhere. The files are read,
+	 *  compiled and linked by a worker thread on a hidden context shared with the context current here, so the render
+	 *  loop never waits on the compiler. gxExec swaps the new program in before calling the draw callback of the window
+	 *  owning that context, and only if it linked; the previous program is deleted.
+	 *
+	 *  \note Watching an object again replaces its files. Render bundles drawing the object are invalidated by a swap,
+	 *  command lists recorded before it keep using the deleted program.
+	 *
+	 *  \see gxSetShaderReloadCallback
+	 */
+	GX_API bool gxWatchShaderFiles(GXObject* object, const char* vertex_shader_path, const char* fragment_shader_path);
+
+	/** \fn void gxUnwatchShaderFiles(GXObject* object)
+	 *  \brief Stops watching the shader files of `object`, a pending recompilation is discarded.
+	 *  \param object Watched object
+	 */
+	GX_API void gxUnwatchShaderFiles(GXObject* object);
+
+	/** \fn void gxSetShaderReloadCallback(GXShaderReloadCallback cb)
+	 *  \brief Sets the callback reporting shader hot reloads, nullptr removes it.
+	 *  \param cb Callback function
+	 */
+	GX_API void gxSetShaderReloadCallback(GXShaderReloadCallback cb);
+
+	/** \fn uint32_t gxHashName(const char* name)
+	 *  \brief Hashes a variable name for the lookups of a GXProgramReflection (32-bit FNV-1a).
+	 *  \param name Variable name
+	 *  \return Name hash.
+	 *
+	 *  \note Hash names once, e.g. at startup, and keep the hashes so the per-frame lookups never touch strings.
+	 */
+	GX_API uint32_t gxHashName(const char* name);
+
+	/** \fn GXProgramReflection* gxAsProgramReflection(GXResource* res)
+	 *  \brief Returns a memory pointer to GXProgramReflection from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated program reflection
+	 */
+	GX_API GXProgramReflection* gxAsProgramReflection(GXResource* res);
+
+	/** \fn GXProgramReflection* gxReflectProgram(uint32_t program)
+	 *  \brief Enumerates the active uniforms, uniform blocks, shader storage blocks and vertex attributes of a linked program.
+	 *  \param program Linked shader program id
+	 *  \return Pointer to program reflection, nullptr if the program is not linked.
+	 *
+	 *  \code
+	 *  static const uint32_t MVP = gxHashName("mvp");
+	 *  GXProgramReflection* reflection = gxReflectProgram(object->shader_program);
+	 *  ...
+	 *  gxSetUniformMat4(reflection, MVP, mvp); // No string is hashed or compared here
+	 *  \endcode
+	 *
+	 *  \note Array uniforms are also found by their name without the `[0]` suffix. A program replaced by a shader
+	 *  hot reload has to be reflected again.
+	 */
+	GX_API GXProgramReflection* gxReflectProgram(uint32_t program);
+
+	/** \fn const GXShaderVariable* gxFindProgramVariable(const GXProgramReflection* reflection, GXProgramInterface program_interface, uint32_t name_hash)
+	 *  \brief Looks up a reflected variable by name hash.
+	 *  \param reflection Program reflection
+	 *  \param program_interface Interface to search
+	 *  \param name_hash gxHashName of the variable name
+	 *  \return Reflected variable, nullptr if the program has no such active variable.
+	 *
+	 *  \note Names of the same interface whose hashes collide are never returned, every lookup of that hash fails
+	 *  rather than answering with the wrong variable. Search `variables` by name in that case.
+	 */
+	GX_API const GXShaderVariable* gxFindProgramVariable(const GXProgramReflection* reflection, GXProgramInterface program_interface, uint32_t name_hash);
+
+	/** \fn int32_t gxGetUniformLocation(const GXProgramReflection* reflection, uint32_t name_hash)
+	 *  \brief Looks up the location of a uniform by name hash.
+	 *  \param reflection Program reflection
+	 *  \param name_hash gxHashName of the uniform name
+	 *  \return Uniform location, -1 if the uniform is not active.
+	 */
+	GX_API int32_t gxGetUniformLocation(const GXProgramReflection* reflection, uint32_t name_hash);
+
+	/** \fn bool gxSetUniform(const GXProgramReflection* reflection, uint32_t name_hash, GXUniformType type, int count, const void* data)
+	 *  \brief Sets a uniform of the reflected program with glProgramUniform*, the program does not need to be bound.
+	 *  \param reflection Program reflection
+	 *  \param name_hash gxHashName of the uniform name
+	 *  \param type Uniform type, must match the declared type
+	 *  \param count Number of array elements
+	 *  \param data Uniform data, tightly packed
+	 *  \return true if the uniform was set, false if it is not active or its declared type differs.
+	 */
+	GX_API bool gxSetUniform(const GXProgramReflection* reflection, uint32_t name_hash, GXUniformType type, int count, const void* data);
+
+	/** \fn bool gxSetUniform1f(const GXProgramReflection* reflection, uint32_t name_hash, float x)
+	 *  \brief Sets a `float` uniform, see gxSetUniform.
+	 */
+	GX_API bool gxSetUniform1f(const GXProgramReflection* reflection, uint32_t name_hash, float x);
+
+	/** \fn bool gxSetUniform2f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y)
+	 *  \brief Sets a `vec2` uniform, see gxSetUniform.
+	 */
+	GX_API bool gxSetUniform2f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y);
+
+	/** \fn bool gxSetUniform3f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y, float z)
+	 *  \brief Sets a `vec3` uniform, see gxSetUniform.
+	 */
+	GX_API bool gxSetUniform3f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y, float z);
+
+	/** \fn bool gxSetUniform4f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y, float z, float w)
+	 *  \brief Sets a `vec4` uniform, see gxSetUniform.
+	 */
+	GX_API bool gxSetUniform4f(const GXProgramReflection* reflection, uint32_t name_hash, float x, float y, float z, float w);
+
+	/** \fn bool gxSetUniform1i(const GXProgramReflection* reflection, uint32_t name_hash, int32_t x)
+	 *  \brief Sets an `int` uniform, see gxSetUniform.
+	 *
+	 *  \note Sampler and image uniforms are also set with this.
+	 */
+	GX_API bool gxSetUniform1i(const GXProgramReflection* reflection, uint32_t name_hash, int32_t x);
+
+	/** \fn bool gxSetUniform1ui(const GXProgramReflection* reflection, uint32_t name_hash, uint32_t x)
+	 *  \brief Sets a `uint` uniform, see gxSetUniform.
+	 */
+	GX_API bool gxSetUniform1ui(const GXProgramReflection* reflection, uint32_t name_hash, uint32_t x);
+
+	/** \fn bool gxSetUniformMat3(const GXProgramReflection* reflection, uint32_t name_hash, const float* m)
+	 *  \brief Sets a column-major `mat3` uniform, see gxSetUniform.
+	 */
+	GX_API bool gxSetUniformMat3(const GXProgramReflection* reflection, uint32_t name_hash, const float* m);
+
+	/** \fn bool gxSetUniformMat4(const GXProgramReflection* reflection, uint32_t name_hash, const float* m)
+	 *  \brief Sets a column-major `mat4` uniform, see gxSetUniform.
+	 */
+	GX_API bool gxSetUniformMat4(const GXProgramReflection* reflection, uint32_t name_hash, const float* m);
+
+	/** \fn GXShaderVariantSet* gxAsShaderVariantSet(GXResource* res)
+	 *  \brief Returns a memory pointer to GXShaderVariantSet from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated shader variant set
+	 */
+	GX_API GXShaderVariantSet* gxAsShaderVariantSet(GXResource* res);
+
+	/** \fn GXShaderVariantSet* gxCreateShaderVariantSet(const char* vertex_shader_src, const char* fragment_shader_src, const char* const* keywords, uint32_t keyword_count)
+	 *  \brief Registers a vertex and fragment source whose variants are selected by feature keywords.
+	 *  \param vertex_shader_src Source code of the vertex shader, copied
+	 *  \param fragment_shader_src Source code of the fragment shader, copied
+	 *  \param keywords Feature keyword names, each one is a macro tested by the sources (`#ifdef`, `#if`, ...)
+	 *  \param keyword_count Number of keywords, at most 64
+	 *  \return Pointer to shader variant set
+	 *
+	 *  \code
+	 *  const char* keywords[] = { "SKINNED", "FOG", "ALPHA_TEST" };
+	 *  GXShaderVariantSet* set = gxCreateShaderVariantSet(vertex_src, fragment_src, keywords, 3);
+	 *  uint32_t program = gxGetShaderVariant(set, (1 << 0) | (1 << 2)); // SKINNED and ALPHA_TEST
+	 *  \endcode
+	 */
+	GX_API GXShaderVariantSet* gxCreateShaderVariantSet(const char* vertex_shader_src, const char* fragment_shader_src, const char* const* keywords, uint32_t keyword_count);
+
+	/** \fn uint32_t gxGetShaderVariant(GXShaderVariantSet* set, uint64_t mask)
+	 *  \brief Returns the program of a keyword combination, compiling it on first request.
+	 *  \param set Shader variant set
+	 *  \param mask Bit `i` enables keyword `i`, bits above GXShaderVariantSet::keyword_count are ignored
+	 *  \return Shader program id, 0 if the variant failed to compile.
+	 *
+	 *  The enabled keywords are defined right after `#version`. Conditional directives on the keywords and on macros
+	 *  defined by the sources are then resolved by gx, and defines of keywords the remaining code does not use are
+	 *  dropped, so combinations that produce the same code are detected by hash and share one program. Sources whose
+	 *  conditionals depend on macros gx cannot evaluate (e.g. GL built-in macros) are compiled without that step.
+	 *
+	 *  \note Programs are owned by the set and deleted with it. A failed variant is not retried.
+	 */
+	GX_API uint32_t gxGetShaderVariant(GXShaderVariantSet* set, uint64_t mask);
+
+	/** \fn const GXProgramCompilationResult* gxGetShaderVariantResult(GXShaderVariantSet* set, uint64_t mask)
+	 *  \brief Returns the compilation result of a variant, e.g. to read its logs after gxGetShaderVariant returned 0.
+	 *  \param set Shader variant set
+	 *  \param mask Variant mask
+	 *  \return Compilation result, nullptr if the variant was not requested yet.
+	 */
+	GX_API const GXProgramCompilationResult* gxGetShaderVariantResult(GXShaderVariantSet* set, uint64_t mask);
+
+	/** \fn uint64_t gxShaderVariantKeyword(GXShaderVariantSet* set, const char* keyword)
+	 *  \brief Returns the mask bit of a keyword.
+	 *  \param set Shader variant set
+	 *  \param keyword Keyword name
+	 *  \return Mask bit of the keyword, 0 if the set has no such keyword.
+	 */
+	GX_API uint64_t gxShaderVariantKeyword(GXShaderVariantSet* set, const char* keyword);
+
+	/** \fn size_t gxPrewarmShaderVariants(GXShaderVariantSet* set, const uint64_t* masks, size_t count)
+	 *  \brief Compiles a declared list of variants up front.
+	 *  \param set Shader variant set
+	 *  \param masks Variant masks
+	 *  \param count Number of variant masks
+	 *  \return Number of the requested variants that compiled successfully.
+	 *
+	 *  \note Distinct programs are submitted together through gxCompileGLSLProgramsAsync when a context is current,
+	 *  so the driver (or the shader workers) compile them in parallel.
+	 */
+	GX_API size_t gxPrewarmShaderVariants(GXShaderVariantSet* set, const uint64_t* masks, size_t count);
+
+	/** \fn GXProgramCompilationResult gxCompileGLSLSeparableStage(const char* shader_src, GXShaderType shader_type)
+	 *  \brief Compiles a GLSL shader from source code and links it alone into a separable program (GL_ARB_separate_shader_objects).
+	 *  \param shader_src Source code of the shader
+	 *  \param shader_type Stage of the shader
+	 *  \return Compilation result, the shader result is stored in the member matching `shader_type`.
+	 *
+	 *  Every stage is compiled and linked once and then combined with any other stage by gxGetProgramPipeline,
+	 *  so M vertex and N fragment shaders cost M + N links instead of M x N.
+	 *
+	 *  \note Outputs of one stage and inputs of the next are matched by location, so interfaces should use
+	 *  `layout(location = ...)`, and vertex shaders have to redeclare `gl_PerVertex` when targeting GLSL 4.10 or newer.
+	 *  Separable programs go through the program binary cache like any other program.
+	 *
+	 *  \see gxGetProgramPipeline
+	 */
+	GX_API GXProgramCompilationResult gxCompileGLSLSeparableStage(const char* shader_src, GXShaderType shader_type);
+
+	/** \fn uint32_t gxGetProgramPipeline(const GXPipelineStages* stages)
+	 *  \brief Returns the program pipeline combining `stages`, created on first use and cached by stage tuple.
+	 *  \param stages Separable stage programs
+	 *  \return Program pipeline id, 0 if no stage is set or no context is current.
+	 *
+	 *  \note Pipelines are container objects and not shared between contexts, they are cached per context and
+	 *  released with their window.
+	 *
+	 *  \see gxBindProgramPipeline
+	 */
+	GX_API uint32_t gxGetProgramPipeline(const GXPipelineStages* stages);
+
+	/** \fn void gxBindProgramPipeline(uint32_t pipeline)
+	 *  \brief Binds a program pipeline, unbinding the current program since a bound program overrides any pipeline.
+	 *  \param pipeline Program pipeline id from gxGetProgramPipeline
+	 *
+	 *  \note Uniforms of the stage programs are set with glProgramUniform*, e.g. through gxSetUniform on their
+	 *  reflections, not through the pipeline.
+	 */
+	GX_API void gxBindProgramPipeline(uint32_t pipeline);
+
+	/** \fn void gxDeleteSeparableStage(uint32_t program)
+	 *  \brief Deletes a separable stage program and drops every cached pipeline using it.
+	 *  \param program Separable stage program
+	 *
+	 *  \note Pipelines of the current context are deleted right away, those of other contexts once a window
+	 *  of that context is drawn.
+	 */
+	GX_API void gxDeleteSeparableStage(uint32_t program);
+
+	/** \fn bool gxSPIRVSupported()
+	 *  \brief Checks whether the current context accepts SPIR-V modules (OpenGL 4.6 or GL_ARB_gl_spirv).
+	 *  \return true if gxCompileSPIRVProgram can be used.
+	 */
+	GX_API bool gxSPIRVSupported();
+
+	/** \fn GXProgramCompilationResult gxCompileSPIRVProgram(const GXSPIRVModule* modules, size_t count)
+	 *  \brief Specializes precompiled SPIR-V modules and links them into a program.
+	 *  \param modules One module per stage
+	 *  \param count Number of modules
+	 *  \return Compilation result, each module's result is stored in the member matching its stage.
+	 *
+	 *  The GLSL front end runs at build time (e.g. `glslangValidator -G`), at startup the driver only specializes
+	 *  the modules with glShaderBinary and glSpecializeShader before linking.
+	 *
+	 *  \note Modules are linked like GLSL shaders and go through the program binary cache, keyed by their code and
+	 *  specialization constants.
+	 */
+	GX_API GXProgramCompilationResult gxCompileSPIRVProgram(const GXSPIRVModule* modules, size_t count);
+
+	/** \fn GXProgramCompilationResult gxCompileGLSLProgramStages(const GXProgramStageSources* sources)
+	 *  \brief Compiles the GLSL vertex, tessellation, geometry and fragment shaders present in `sources` and links them.
+	 *  \param sources Stage sources
+	 *  \return Compilation result, every stage result is stored in its own member.
+	 *
+	 *  Tessellation and geometry stages amplify geometry on the GPU: coarse patches drawn with GX_PRIMITIVE_PATCHES
+	 *  are subdivided by the tessellator instead of uploading dense meshes.
+	 *
+	 *  \code
+	 *  GXProgramStageSources terrain = { vertex_src, tess_control_src, tess_evaluation_src, nullptr, fragment_src };
+	 *  GXProgramCompilationResult program = gxCompileGLSLProgramStages(&terrain);
+	 *  ...
+	 *  gxSetPatchVertices(4);
+	 *  gxDrawPrimitives(object, GX_PRIMITIVE_PATCHES, 0, patch_count * 4);
+	 *  \endcode
+	 *
+	 *  \note A tessellation evaluation shader is required for tessellation, the control shader is optional.
+	 */
+	GX_API GXProgramCompilationResult gxCompileGLSLProgramStages(const GXProgramStageSources* sources);
+
+	/** \fn void gxSetPatchVertices(int count)
+	 *  \brief Sets the number of vertices forming one patch of GX_PRIMITIVE_PATCHES draws.
+	 *  \param count Vertices per patch
+	 */
+	GX_API void gxSetPatchVertices(int count);
+
+	/** \fn void gxSetPatchDefaultLevels(const float* outer, const float* inner)
+	 *  \brief Sets the tessellation levels used when a program has no tessellation control shader.
+	 *  \param outer 4 outer tessellation levels, nullptr keeps the current ones
+	 *  \param inner 2 inner tessellation levels, nullptr keeps the current ones
+	 */
+	GX_API void gxSetPatchDefaultLevels(const float* outer, const float* inner);
+
+	/** \fn size_t gxPrewarm(const GXPrewarmEntry* entries, size_t count)
+	 *  \brief Issues a throwaway draw for every combination into a tiny offscreen target, so drivers finish
+	 *  compiling the state-dependent shader variants during loading instead of at their first real draw.
+	 *  \param entries Combinations to warm up
+	 *  \param count Number of combinations
+	 *  \return Number of combinations drawn.
+	 *
+	 *  \note The GL state touched by the warm-up draws is restored. Combinations warmed up here are not reported
+	 *  by the hitch tracking.
+	 *
+	 *  \see gxEnableHitchTracking
+	 */
+	GX_API size_t gxPrewarm(const GXPrewarmEntry* entries, size_t count);
+
+	/** \fn void gxEnableHitchTracking(bool enable)
+	 *  \brief Enables recording of combinations first drawn while gxExec is drawing a frame.
+	 *  \param enable Tracking flag
+	 *
+	 *  Draws through gxDrawPrimitives, gxDrawPrimitiveElements, gxDrawVertices and gxDrawElements are keyed by
+	 *  program, vertex layout, primitive, index type and depth, blend and cull state. Combinations seen outside a
+	 *  frame (e.g. while loading) or warmed up by gxPrewarm are not reported.
+	 *
+	 *  \note Tracking queries GL state on every draw, enable it only to build the prewarm list. The vertex layout
+	 *  of an object is read once and cached until gx changes it, call gxClearHitchReport after changing a vertex
+	 *  array directly through GL.
+	 */
+	GX_API void gxEnableHitchTracking(bool enable);
+
+	/** \fn size_t gxGetHitchReport(GXHitchRecord* out_records, size_t capacity)
+	 *  \brief Copies the combinations first drawn mid-frame, in order of appearance.
+	 *  \param out_records Output array, nullptr to query the number of records
+	 *  \param capacity Capacity of `out_records`
+	 *  \return Number of records, or the number of records copied if `out_records` is set.
+	 */
+	GX_API size_t gxGetHitchReport(GXHitchRecord* out_records, size_t capacity);
+
+	/** \fn void gxClearHitchReport()
+	 *  \brief Clears the hitch report and forgets every combination seen so far.
+	 */
+	GX_API void gxClearHitchReport();
+
+	/** \fn GXReadbackRing* gxAsReadbackRing(GXResource* res)
+	 *  \brief Returns a memory pointer to GXReadbackRing from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated readback ring
+	 */
+	GX_API GXReadbackRing* gxAsReadbackRing(GXResource* res);
+
+	/** \fn GXReadbackRing* gxCreateReadbackRing(uint32_t slot_count)
+	 *  \brief Creates a ring of pixel pack buffers for asynchronous framebuffer reads.
+	 *  \param slot_count Number of reads that can be in flight, 3 lets a frame be mapped two frames after it was read
+	 *  \return Pointer to readback ring, or nullptr on failure
+	 *
+	 *  Buffers are allocated lazily and grow to the largest read queued into them.
+	 */
+	GX_API GXReadbackRing* gxCreateReadbackRing(uint32_t slot_count);
+
+	/** \fn uint64_t gxReadPixelsAsync(GXReadbackRing* ring, uint32_t framebuffer, int x, int y, int width, int height, GXPixelFormat format)
+	 *  \brief Queues a read of a framebuffer rectangle into the next buffer of the ring and returns immediately.
+	 *  \param ring Readback ring
+	 *  \param framebuffer Framebuffer object id, 0 for the default framebuffer of the current context
+	 *  \param x Left edge of the rectangle
+	 *  \param y Bottom edge of the rectangle
+	 *  \param width Width of the rectangle
+	 *  \param height Height of the rectangle
+	 *  \param format Pixel format
+	 *  \return Ticket identifying the read, 0 on failure or if the buffer to reuse is still mapped.
+	 *
+	 *  A fence is inserted after the copy; gxMapReadback returns the pixels once it has signaled, usually one or two
+	 *  frames later. Completed reads that were never mapped are recycled and counted in `dropped`.
+	 *
+	 *  \note The read framebuffer and pixel pack state are restored.
+	 *
+	 *  \code
+	 *  // In the draw callback, after drawing
+	 *  uint64_t ticket = gxReadWindowPixelsAsync(ring, window, GX_PIXEL_FORMAT_RGBA8);
+	 *  pending.push_back(ticket);
+	 *
+	 *  GXReadbackResult frame;
+	 *  while (!pending.empty() && gxMapReadback(ring, pending.front(), false, &frame)) {
+	 *      encode(frame.data, frame.width, frame.height);
+	 *      gxUnmapReadback(ring, pending.front());
+	 *      pending.pop_front();
+	 *  }
+	 *  \endcode
 	 */
-	GX_API GXShaderCompilationResult gxCompileGLSLShader(const char* shader_src, GXShaderType shader_type);
-	
-	/** \fn GXProgramCompilationResult gxCompileGLSLProgram(const char* vertex_shader_src, const char* fragment_shader_src)
-	 *  \brief Compiles a GLSL vertex and fragment shader from source code.
-	 *  \param vertex_shader_src Source code of the vertex shader
-	 *  \param fragment_shader_src Source code of the fragment shader
-	 *  \return Compilation result.
-	 * 
-	 *  \see GXProgramCompilationResult
+	GX_API uint64_t gxReadPixelsAsync(GXReadbackRing* ring, uint32_t framebuffer, int x, int y, int width, int height, GXPixelFormat format);
+
+	/** \fn uint64_t gxReadWindowPixelsAsync(GXReadbackRing* ring, GXWindow* win, GXPixelFormat format)
+	 *  \brief Queues a read of the whole default framebuffer of a window.
+	 *  \param ring Readback ring
+	 *  \param win Window, its context must be current (as it is inside its draw callback)
+	 *  \param format Pixel format
+	 *  \return Ticket identifying the read, 0 on failure.
+	 *  \see gxReadPixelsAsync
 	 */
-	GX_API GXProgramCompilationResult gxCompileGLSLProgram(const char* vertex_shader_src, const char* fragment_shader_src);
+	GX_API uint64_t gxReadWindowPixelsAsync(GXReadbackRing* ring, GXWindow* win, GXPixelFormat format);
 
-	/** \fn uint32_t gxGenVertexArrayObject()
-	 *  \brief Generates a new Vertex Array Object (VAO).
-	 *  \return Vertex Array Object (VAO) id.
+	/** \fn bool gxReadbackReady(GXReadbackRing* ring, uint64_t ticket)
+	 *  \brief Returns whether the GPU has finished the read of a ticket, without waiting.
+	 *  \param ring Readback ring
+	 *  \param ticket Ticket returned by gxReadPixelsAsync
+	 *  \return true if the read can be mapped without stalling, false if it is pending or the ticket was recycled.
 	 */
-	GX_API uint32_t gxGenVertexArrayObject();
+	GX_API bool gxReadbackReady(GXReadbackRing* ring, uint64_t ticket);
 
-	/** \fn void gxBindVertexArrayObject(uint32_t vao)
-	 *  \brief Binds a Vertex Array Object (VAO) for use.
-	 *  \param vao Vertex array object (VAO) id to bind
+	/** \fn bool gxMapReadback(GXReadbackRing* ring, uint64_t ticket, bool wait, GXReadbackResult* out_result)
+	 *  \brief Maps the pixels of a completed read.
+	 *  \param ring Readback ring
+	 *  \param ticket Ticket returned by gxReadPixelsAsync
+	 *  \param wait Wait for the read to complete instead of failing while it is pending
+	 *  \param out_result Output mapped pixels, valid until gxUnmapReadback
+	 *  \return true if mapped, false if pending (without `wait`) or if the ticket was recycled.
 	 */
-	GX_API void gxBindVertexArrayObject(uint32_t vao);
+	GX_API bool gxMapReadback(GXReadbackRing* ring, uint64_t ticket, bool wait, GXReadbackResult* out_result);
 
-	/** \fn uint32_t gxGenBufferObject(GXBufferType buffer_type, GXBufferUsageType buffer_usage, size_t size, void* data)
-	 *  \brief Generates a new (Array/Element Array) Buffer Object.
-	 *  \param buffer_type Type of buffer
-	 *  \param buffer_usage Buffer usage type
-	 *  \param size Size of	`data`
-	 *  \param data Data to place in buffer
-	 *  \returns (Array/Element Array) Buffer Object id
-	 * 
-	 *  \see GXBufferType
-	 *  \see GXBufferUsageType
+	/** \fn void gxUnmapReadback(GXReadbackRing* ring, uint64_t ticket)
+	 *  \brief Unmaps the pixels of a read, letting its buffer be reused.
+	 *  \param ring Readback ring
+	 *  \param ticket Ticket passed to gxMapReadback
 	 */
-	GX_API uint32_t gxGenBufferObject(GXBufferType buffer_type, GXBufferUsageType buffer_usage, size_t size, void* data);
+	GX_API void gxUnmapReadback(GXReadbackRing* ring, uint64_t ticket);
 
-	/** \fn void gxBindBufferObject(GXBufferType buffer_type, uint32_t buffer)
-	 *  \brief Binds a (Array/Element Array) Buffer Object for use.
-	 *  \param buffer_type Type of buffer
-	 *  \param buffer (Array/Element Array) Buffer Object id
-	 * 
-	 *  \see GXBufferType
+	/** \fn GXCapture* gxAsCapture(GXResource* res)
+	 *  \brief Returns a memory pointer to GXCapture from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated capture
 	 */
-	GX_API void gxBindBufferObject(GXBufferType buffer_type, uint32_t buffer);
+	GX_API GXCapture* gxAsCapture(GXResource* res);
 
-	/** \fn void* gxMapBufferRange(GXBufferType buffer_type, size_t offset, size_t length, GXMappingBits bits)
-	 *  \brief Maps a range of a (Array/Element Array) Buffer Object to CPU memory, allowing access (based of `bits`).
-	 *  \param buffer_type Type of buffer to map
-	 *  \param offset Offset in bytes from the start of the buffer
-	 *  \param length Length in bytes of the range to map
-	 *  \param bits Mapping bits that control how the buffer is accessed
-	 *  \return Pointer to the mapped buffer range, or `nullptr` (or its respective alternative) on failure.
-	 * 
-	 *  \note This is equivalent to glMapBufferRange, and simply a wrapper to allow easier binding implementation.
+	/** \fn GXCapture* gxCreateCapture(const GXCaptureOptions* options)
+	 *  \brief Opens the capture output and starts its encoding workers.
+	 *  \param options Capture configuration
+	 *  \return Pointer to capture, or nullptr if the output could not be opened or the PNG pattern is invalid
+	 *
+	 *  Frames are read back asynchronously, copied on the thread calling gxCaptureFrame once their fence has signaled,
+	 *  and encoded by the workers. Streams are written in frame order whatever worker encodes a frame.
+	 *
+	 *  \code
+	 *  GXCaptureOptions options = { GX_CAPTURE_Y4M, "| ffmpeg -y -i - capture.mp4", 60, 0, 0, GX_CAPTURE_BACKPRESSURE_BLOCK };
+	 *  GXCapture* capture = gxCreateCapture(&options);
+	 *  // In the draw callback, after drawing
+	 *  gxCaptureWindow(capture, window);
+	 *  \endcode
+	 *
+	 *  \note Destroying the capture flushes pending frames and closes the output.
 	 */
-	GX_API void* gxMapBufferRange(GXBufferType buffer_type, size_t offset, size_t length, GXMappingBits bits);
+	GX_API GXCapture* gxCreateCapture(const GXCaptureOptions* options);
 
-	/** \fn void gxUnmapBuffer(GXBufferType buffer_type)
-	 *  \brief Unmaps a previously mapped (Array/Element Array) Buffer Object.
-	 *  \param buffer_type Type of buffer to unmap
-	 *  \return true if the buffer was successfully unmapped, false if it was not (likely due to memory issues).
+	/** \fn bool gxCaptureFrame(GXCapture* capture, uint32_t framebuffer, int x, int y, int width, int height)
+	 *  \brief Queues a framebuffer rectangle for capture and hands completed earlier reads to the workers.
+	 *  \param capture Capture
+	 *  \param framebuffer Framebuffer object id, 0 for the default framebuffer of the current context
+	 *  \param x Left edge of the rectangle
+	 *  \param y Bottom edge of the rectangle
+	 *  \param width Width of the rectangle
+	 *  \param height Height of the rectangle
+	 *  \return true if the frame was queued, false if it was dropped.
+	 *  \note Streams keep the size of their first frame, frames of another size are counted as failed.
+	 */
+	GX_API bool gxCaptureFrame(GXCapture* capture, uint32_t framebuffer, int x, int y, int width, int height);
+
+	/** \fn bool gxCaptureWindow(GXCapture* capture, GXWindow* win)
+	 *  \brief Queues the whole default framebuffer of a window for capture.
+	 *  \param capture Capture
+	 *  \param win Window, its context must be current (as it is inside its draw callback)
+	 *  \return true if the frame was queued, false if it was dropped.
+	 */
+	GX_API bool gxCaptureWindow(GXCapture* capture, GXWindow* win);
+
+	/** \fn void gxCaptureFlush(GXCapture* capture)
+	 *  \brief Waits until every queued frame has been written.
+	 *  \param capture Capture
+	 */
+	GX_API void gxCaptureFlush(GXCapture* capture);
+
+	/** \fn GXCaptureStats gxGetCaptureStats(GXCapture* capture)
+	 *  \brief Returns the counters and sustained frame rate of a capture.
+	 *  \param capture Capture
+	 *  \return Capture counters.
+	 */
+	GX_API GXCaptureStats gxGetCaptureStats(GXCapture* capture);
+
+	/** \fn GXRenderTarget* gxAsRenderTarget(GXResource* res)
+	 *  \brief Returns a memory pointer to GXRenderTarget from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated render target
+	 */
+	GX_API GXRenderTarget* gxAsRenderTarget(GXResource* res);
+
+	/** \fn GXRenderTarget* gxCreateRenderTarget(const GXRenderTargetDesc* desc)
+	 *  \brief Creates a framebuffer object with its color and depth attachments.
+	 *  \param desc Size, formats and sample count
+	 *  \return Pointer to render target, or nullptr if the framebuffer is incomplete
+	 */
+	GX_API GXRenderTarget* gxCreateRenderTarget(const GXRenderTargetDesc* desc);
+
+	/** \fn void gxBindRenderTarget(GXRenderTarget* target)
+	 *  \brief Binds a render target for drawing, enables its color attachments and sets the viewport to its size.
+	 *  \param target Render target, nullptr binds the default framebuffer of the current window
+	 */
+	GX_API void gxBindRenderTarget(GXRenderTarget* target);
+
+	/** \fn void gxResolveRenderTarget(GXRenderTarget* target)
+	 *  \brief Resolves the multisample attachments of a render target into its textures.
+	 *  \param target Render target, single sampled targets are left untouched
+	 */
+	GX_API void gxResolveRenderTarget(GXRenderTarget* target);
+
+	/** \fn GXRenderTarget* gxAcquireTransientRenderTarget(const GXRenderTargetDesc* desc)
+	 *  \brief Returns an unused pooled render target matching `desc`, creating one when none is free.
+	 *  \param desc Size, formats and sample count
+	 *  \return Pointer to render target, or nullptr on failure
 	 *
-	 *  \note This is equivalent to glUnmapBuffer, and simply a wrapper to allow easier binding implementation.
+	 *  Effect passes and resizes reuse pooled targets instead of reallocating them. Framebuffers are not shared between
+	 *  contexts, so every window has its own pool. Targets left unused for 8 frames of their window are deleted by gxExec.
+	 *
+	 *  \code
+	 *  GXRenderTargetDesc desc = { window->width / 2, window->height / 2, { GL_RGBA16F }, 1, 0, 0 };
+	 *  GXRenderTarget* bloom = gxAcquireTransientRenderTarget(&desc);
+	 *  gxBindRenderTarget(bloom);
+	 *  ...
+	 *  gxReleaseTransientRenderTarget(bloom);
+	 *  \endcode
 	 */
-	GX_API bool gxUnmapBuffer(GXBufferType buffer_type);
+	GX_API GXRenderTarget* gxAcquireTransientRenderTarget(const GXRenderTargetDesc* desc);
 
-	/** \fn void gxBufferData(GXBufferType buffer_type, size_t size, void* data, GXBufferUsageType usage)
-	 *  \brief Allocates and initializes a (Array/Element Array) Buffer Object with data.
-	 *  \param buffer_type Type of buffer to allocate
-	 *  \param size Size of the buffer in bytes
-	 *  \param data Data to initialize the buffer with
-	 *  \param usage Buffer usage type
+	/** \fn void gxReleaseTransientRenderTarget(GXRenderTarget* target)
+	 *  \brief Returns a transient render target to the pool, its contents are undefined when acquired again.
+	 *  \param target Render target returned by gxAcquireTransientRenderTarget
+	 */
+	GX_API void gxReleaseTransientRenderTarget(GXRenderTarget* target);
+
+	/** \fn void gxTrimTransientRenderTargets()
+	 *  \brief Deletes every unused pooled render target of the current context.
+	 */
+	GX_API void gxTrimTransientRenderTargets();
+
+	/** \fn GXRenderGraph* gxAsRenderGraph(GXResource* res)
+	 *  \brief Returns a memory pointer to GXRenderGraph from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated render graph
+	 */
+	GX_API GXRenderGraph* gxAsRenderGraph(GXResource* res);
+
+	/** \fn GXRenderGraph* gxCreateRenderGraph()
+	 *  \brief Creates an empty render graph.
+	 *  \return Pointer to render graph
 	 *
-	 *  \note This is equivalent to glBufferSubData, and simply a wrapper to allow easier binding implementation.
+	 *  The graph is declared every frame: passes declare the textures and buffers they read and write, gxRenderGraphCompile
+	 *  orders them, culls passes whose outputs reach no imported resource, places memory barriers and MSAA resolves, and
+	 *  lets transient resources whose lifetimes do not overlap share the same render target or buffer.
+	 *
+	 *  \code
+	 *  gxRenderGraphReset(graph);
+	 *  uint32_t hdr = gxRenderGraphCreateTexture(graph, &hdr_desc, "hdr");
+	 *  uint32_t bloom = gxRenderGraphCreateTexture(graph, &bloom_desc, "bloom");
+	 *  uint32_t backbuffer = gxRenderGraphImportTarget(graph, nullptr, "backbuffer");
+	 *
+	 *  uint32_t scene = gxRenderGraphAddPass(graph, "scene", draw_scene, nullptr);
+	 *  gxRenderGraphWrite(graph, scene, hdr);
+	 *  uint32_t blur = gxRenderGraphAddPass(graph, "bloom", draw_bloom, nullptr);
+	 *  gxRenderGraphRead(graph, blur, hdr);
+	 *  gxRenderGraphWrite(graph, blur, bloom);
+	 *  uint32_t tonemap = gxRenderGraphAddPass(graph, "tonemap", draw_tonemap, nullptr);
+	 *  gxRenderGraphRead(graph, tonemap, hdr);
+	 *  gxRenderGraphRead(graph, tonemap, bloom);
+	 *  gxRenderGraphWrite(graph, tonemap, backbuffer);
+	 *
+	 *  gxRenderGraphCompile(graph);
+	 *  gxRenderGraphExecute(graph);
+	 *  \endcode
 	 */
-	GX_API void gxBufferSubData(GXBufferType buffer_type, size_t offset, size_t length, void* data);
+	GX_API GXRenderGraph* gxCreateRenderGraph();
 
-	/** \fn bool gxUpdateBufferObject(GXBufferType type, uint32_t bo, size_t offset, size_t length, void* data)
-	 *  \brief Updates data in a (Array/Element Array/Uniform) Buffer Object.
-	 *  \param type Type of buffer to update
-	 *  \param bo Buffer Object id to update
-	 *  \param offset Offset in bytes from the start of the buffer
-	 *  \param length Length in bytes of the data to update
-	 *  \param data Pointer to the new data
-	 *  \return true if the buffer was successfully updated, false if it was not (likely due to memory issues).
+	/** \fn void gxRenderGraphReset(GXRenderGraph* graph)
+	 *  \brief Clears the declared passes and resources, keeping the physical resources for reuse.
+	 *  \param graph Render graph
 	 */
-	GX_API bool gxUpdateBufferObject(GXBufferType type, uint32_t bo, size_t offset, size_t length, void* data);
+	GX_API void gxRenderGraphReset(GXRenderGraph* graph);
 
-	/** \fn void gxUpdateVertices(GXObject* object, size_t offset, size_t length, void* data)
-	 *  \brief Updates the vertex data of a GXObject.
-	 *  \param object Pointer to the GXObject to update
-	 *  \param offset Offset in bytes from the start of the vertex buffer
-	 *  \param length Length in bytes of the data to update
-	 *  \param data Pointer to the new vertex data
-	 *  \return true if the vertices were successfully updated, false if it was not (likely due to memory issues).
+	/** \fn uint32_t gxRenderGraphCreateTexture(GXRenderGraph* graph, const GXRenderTargetDesc* desc, const char* name)
+	 *  \brief Declares a transient render target living only between its first and last use in the frame.
+	 *  \param graph Render graph
+	 *  \param desc Size, formats and sample count
+	 *  \param name Debug name, may be nullptr
+	 *  \return Resource handle, 0 on failure.
+	 */
+	GX_API uint32_t gxRenderGraphCreateTexture(GXRenderGraph* graph, const GXRenderTargetDesc* desc, const char* name);
+
+	/** \fn uint32_t gxRenderGraphCreateBuffer(GXRenderGraph* graph, size_t size, const char* name)
+	 *  \brief Declares a transient buffer living only between its first and last use in the frame.
+	 *  \param graph Render graph
+	 *  \param size Size in bytes
+	 *  \param name Debug name, may be nullptr
+	 *  \return Resource handle, 0 on failure.
+	 */
+	GX_API uint32_t gxRenderGraphCreateBuffer(GXRenderGraph* graph, size_t size, const char* name);
+
+	/** \fn uint32_t gxRenderGraphImportTarget(GXRenderGraph* graph, GXRenderTarget* target, const char* name)
+	 *  \brief Declares an external render target, passes writing it are the outputs of the graph and are never culled.
+	 *  \param graph Render graph
+	 *  \param target Render target, nullptr for the default framebuffer of the current window
+	 *  \param name Debug name, may be nullptr
+	 *  \return Resource handle, 0 on failure.
+	 */
+	GX_API uint32_t gxRenderGraphImportTarget(GXRenderGraph* graph, GXRenderTarget* target, const char* name);
+
+	/** \fn uint32_t gxRenderGraphAddPass(GXRenderGraph* graph, const char* name, GXRenderPassCallback callback, void* user_data)
+	 *  \brief Declares a pass.
+	 *  \param graph Render graph
+	 *  \param name Debug name, may be nullptr
+	 *  \param callback Called when the pass executes
+	 *  \param user_data User-defined data pointer passed to `callback`
+	 *  \return Pass handle, 0 on failure.
+	 */
+	GX_API uint32_t gxRenderGraphAddPass(GXRenderGraph* graph, const char* name, GXRenderPassCallback callback, void* user_data);
+
+	/** \fn void gxRenderGraphRead(GXRenderGraph* graph, uint32_t pass, uint32_t handle)
+	 *  \brief Declares that a pass reads a resource, ordering it after the last pass declared before it that writes the resource.
+	 *  \param graph Render graph
+	 *  \param pass Pass handle
+	 *  \param handle Resource handle
+	 */
+	GX_API void gxRenderGraphRead(GXRenderGraph* graph, uint32_t pass, uint32_t handle);
+
+	/** \fn void gxRenderGraphWrite(GXRenderGraph* graph, uint32_t pass, uint32_t handle)
+	 *  \brief Declares that a pass writes a resource. The first render target a pass writes is bound before its callback.
+	 *  \param graph Render graph
+	 *  \param pass Pass handle
+	 *  \param handle Resource handle
+	 *  \note Passes accumulating into a resource (e.g. blending) also declare it as read.
+	 */
+	GX_API void gxRenderGraphWrite(GXRenderGraph* graph, uint32_t pass, uint32_t handle);
+
+	/** \fn bool gxRenderGraphCompile(GXRenderGraph* graph)
+	 *  \brief Orders and culls the passes, places barriers and resolves, and assigns physical resources.
+	 *  \param graph Render graph
+	 *  \return true on success, false if a physical resource could not be created.
+	 */
+	GX_API bool gxRenderGraphCompile(GXRenderGraph* graph);
+
+	/** \fn void gxRenderGraphExecute(GXRenderGraph* graph)
+	 *  \brief Runs the passes kept by the last compile in order.
+	 *  \param graph Render graph
+	 */
+	GX_API void gxRenderGraphExecute(GXRenderGraph* graph);
+
+	/** \fn GXRenderTarget* gxRenderGraphGetTarget(GXRenderGraph* graph, uint32_t handle)
+	 *  \brief Returns the render target backing a texture or imported handle after compiling.
+	 *  \param graph Render graph
+	 *  \param handle Resource handle
+	 *  \return Render target, nullptr for the default framebuffer or unknown handles.
+	 *  \note Aliased textures share the render target, its contents are undefined when a pass first writes it.
+	 */
+	GX_API GXRenderTarget* gxRenderGraphGetTarget(GXRenderGraph* graph, uint32_t handle);
+
+	/** \fn uint32_t gxRenderGraphGetBuffer(GXRenderGraph* graph, uint32_t handle)
+	 *  \brief Returns the buffer object backing a buffer handle after compiling.
+	 *  \param graph Render graph
+	 *  \param handle Resource handle
+	 *  \return Buffer object id, 0 for unknown handles.
+	 */
+	GX_API uint32_t gxRenderGraphGetBuffer(GXRenderGraph* graph, uint32_t handle);
+
+	/** \fn GXDynamicResolution* gxAsDynamicResolution(GXResource* res)
+	 *  \brief Returns a memory pointer to GXDynamicResolution from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated dynamic resolution controller
+	 */
+	GX_API GXDynamicResolution* gxAsDynamicResolution(GXResource* res);
+
+	/** \fn GXDynamicResolution* gxCreateDynamicResolution(const GXDynamicResolutionOptions* options)
+	 *  \brief Creates a dynamic resolution controller.
+	 *  \param options Controller configuration
+	 *  \return Pointer to dynamic resolution controller, or nullptr on invalid options
 	 *
+	 *  \code
+	 *  // In the draw callback
+	 *  gxDynamicResolutionBegin(resolution, window);
+	 *  draw_scene(resolution->width, resolution->height);
+	 *  gxDynamicResolutionEnd(resolution, window);
+	 *  draw_ui();  // Native resolution
+	 *  \endcode
 	 */
-	GX_API bool gxUpdateVertices(GXObject* object, size_t offset, size_t length, void* data);
+	GX_API GXDynamicResolution* gxCreateDynamicResolution(const GXDynamicResolutionOptions* options);
 
-	/** \fn bool gxUpdateElements(GXObject* object, size_t offset, size_t length, void* data)
-	 *  \brief Updates the index data of a GXObject.
-	 *  \param object Pointer to the GXObject to update
-	 *  \param offset Offset in bytes from the start of the element buffer
-	 *  \param length Length in bytes of the data to update
-	 *  \param data Pointer to the new index data
-	 *  \return true if the elements were successfully updated, false if it was not (likely due to memory issues).
-	 * 
+	/** \fn GXRenderTarget* gxDynamicResolutionBegin(GXDynamicResolution* resolution, GXWindow* win)
+	 *  \brief Updates the render scale from the completed GPU timings, binds the scene target and starts timing.
+	 *  \param resolution Dynamic resolution controller
+	 *  \param win Window the scene is drawn for
+	 *  \return Scene render target, with the viewport set to the scaled size.
+	 *
+	 *  Timings are read one or more frames late without waiting for the GPU. The target is only reallocated when the window
+	 *  size changes, scale changes only move the viewport.
 	 */
-	GX_API bool gxUpdateElements(GXObject* object, size_t offset, size_t length, void* data);
+	GX_API GXRenderTarget* gxDynamicResolutionBegin(GXDynamicResolution* resolution, GXWindow* win);
 
-	/** \fn bool gxUpdateUniformBlock(uint32_t ubo, size_t offset, size_t length, void* data)
-	 *  \brief Updates the index data of a GXObject.
-	 *  \param ubo Uniform Buffer Object id to update
-	 *  \param offset Offset in bytes from the start of the uniform buffer
-	 *  \param length Length in bytes of the data to update
-	 *  \param data Pointer to the new index data
-	 *  \return true if the uniforms were successfully updated, false if it was not (likely due to memory issues).
+	/** \fn void gxDynamicResolutionEnd(GXDynamicResolution* resolution, GXWindow* win)
+	 *  \brief Stops timing and upscales the scene to the window framebuffer with bilinear filtering.
+	 *  \param resolution Dynamic resolution controller
+	 *  \param win Window the scene is drawn for
 	 *
+	 *  The default framebuffer is bound afterwards and its viewport set by gxUpdateViewport.
 	 */
-	GX_API bool gxUpdateUniformBlock(uint32_t ubo, size_t offset, size_t length, void* data);
+	GX_API void gxDynamicResolutionEnd(GXDynamicResolution* resolution, GXWindow* win);
 
-	/** \fn void gxSetVertexAttribute(GXObject* object, uint32_t index, int size, GXVertexAttributeType type, bool normalize, size_t stride, void* pointer)
-	 *  \brief Sets a vertex attribute for a GXObject.
-	 *  \param object Pointer to the GXObject to set the attribute for
-	 *  \param index Index of the vertex attribute
-	 *  \param size Number of components per vertex attribute (1, 2, 3, or 4)
-	 *  \param type Data type of the vertex attribute (e.g., float, int)
-	 *  \param normalize Whether to normalize the vertex attribute data
-	 *  \param stride Byte offset between consecutive vertex attributes
-	 *  \param pointer Pointer to the vertex attribute data in the buffer
-	 *  
-	 *  \see GXVertexAttributeType
+	/** \fn bool gxRenderTiled(const GXTiledRenderOptions* options, GXTileDrawCallback draw, void* user_data)
+	 *  \brief Renders an image larger than the viewport and renderbuffer limits tile by tile, streaming tiles to disk.
+	 *  \param options Tiled render configuration
+	 *  \param draw Called once per tile with the tile target bound
+	 *  \param user_data User-defined data pointer passed to `draw`
+	 *  \return true if every tile was rendered and written, false if otherwise.
+	 *
+	 *  Tile reads are pipelined through pixel pack buffers so drawing a tile overlaps writing the previous one, and only two
+	 *  tiles per context are ever held in memory.
+	 *
+	 *  With several contexts, hidden windows sharing the current context draw tiles on worker threads: `draw` is called
+	 *  concurrently and must only use objects shared between contexts (programs, buffers, textures). Vertex array objects are
+	 *  not shared, keep one per `context_index`.
+	 *
+	 *  \code
+	 *  void draw_tile(const GXTile* tile, void* user_data) {
+	 *      float projection[16];
+	 *      multiply(projection, tile->projection, scene_projection);
+	 *      draw_scene(projection, vaos[tile->context_index]);
+	 *  }
+	 *  GXTiledRenderOptions options = { 32768, 16384, 0, 0, {}, GX_TILED_OUTPUT_PPM, "poster.ppm", 1 };
+	 *  gxRenderTiled(&options, draw_tile, nullptr);
+	 *  \endcode
 	 */
-	GX_API void gxSetVertexAttribute(GXObject* object, uint32_t index, int size, GXVertexAttributeType type, bool normalize, size_t stride, void* pointer);
+	GX_API bool gxRenderTiled(const GXTiledRenderOptions* options, GXTileDrawCallback draw, void* user_data);
 
-	/** \fn void gxEnableVertexAttribute(GXObject* object, uint32_t index)
-	 *  \brief Enables a vertex attribute for a GXObject.
-	 *  \param object Pointer to the GXObject to enable the attribute for
-	 *  \param index Index of the vertex attribute to enable
+	/** \fn GXSoftwareRenderer* gxAsSoftwareRenderer(GXResource* res)
+	 *  \brief Returns a memory pointer to GXSoftwareRenderer from the specified GXResource.
+	 *  \param res Resource memory pointer
+	 *  \return Associated software renderer
 	 */
-	GX_API void gxEnableVertexAttribute(GXObject* object, uint32_t index);
+	GX_API GXSoftwareRenderer* gxAsSoftwareRenderer(GXResource* res);
 
-	/** \fn void gxDisableVertexAttribute(GXObject* object, uint32_t index)
-	 *  \brief Disables a vertex attribute for a GXObject.
-	 *  \param object Pointer to the GXObject to disable the attribute for
-	 *  \param index Index of the vertex attribute to disable
+	/** \fn GXSoftwareRenderer* gxCreateSoftwareRenderer(const GXSoftwareRendererOptions* options)
+	 *  \brief Creates a CPU rasterizer and its worker threads.
+	 *  \param options Renderer configuration
+	 *  \return Pointer to software renderer, or nullptr on invalid options
+	 *
+	 *  Draws are transformed and clipped in parallel, then binned into 64x64 pixel tiles. gxSoftwareFinish rasterizes the
+	 *  tiles on all threads, each tile drawing its triangles in submission order, several pixels at a time with the SIMD
+	 *  instruction set selected at creation. No window or OpenGL context is needed, which suits machines without a GPU.
+	 *
+	 *  \code
+	 *  GXSoftwareRendererOptions options = { 1920, 1080, 0, GX_SOFTWARE_ISA_AUTO };
+	 *  GXSoftwareRenderer* renderer = gxCreateSoftwareRenderer(&options);
+	 *  float background[4] = { 0.1f, 0.1f, 0.1f, 1.0f };
+	 *  gxSoftwareClear(renderer, background, 1.0f);
+	 *  GXSoftwareDraw draw = { vertices, &layout, indices, index_count, GX_PRIMITIVE_TRIANGLES, mvp, model,
+	 *                          GX_SOFTWARE_SHADING_FACETED, { 0.8f, 0.6f, 0.2f, 1.0f }, { 0.3f, 1.0f, 0.5f }, 0.2f, true, true, true };
+	 *  gxSoftwareDraw(renderer, &draw);
+	 *  gxSoftwareFinish(renderer);
+	 *  save_image(renderer->pixels, renderer->stride, 1920, 1080);
+	 *  \endcode
 	 */
-	GX_API void gxDisableVertexAttribute(GXObject* object, uint32_t index);
+	GX_API GXSoftwareRenderer* gxCreateSoftwareRenderer(const GXSoftwareRendererOptions* options);
 
-	/** \fn void gxBindBufferBase(GXBufferType type, uint32_t binding_point, uint32_t bo)
-	 *  \brief Binds a Buffer Object to a specific binding point.
-	 *  \param type Type of buffer to bind (e.g., uniform, array)
-	 *  \param binding_point Binding point index to bind the buffer to
-	 *  \param bo Buffer Object id to bind
+	/** \fn void gxSoftwareClear(GXSoftwareRenderer* renderer, const float* color, float depth)
+	 *  \brief Clears the color and depth buffers, discarding triangles not rasterized yet.
+	 *  \param renderer Software renderer
+	 *  \param color RGBA clear color, nullptr to leave the color buffer, queued triangles are then rasterized first
+	 *  \param depth Clear depth, from 0 to 1
 	 */
-	GX_API void gxBindBufferBase(GXBufferType type, uint32_t binding_point, uint32_t bo);
+	GX_API void gxSoftwareClear(GXSoftwareRenderer* renderer, const float* color, float depth);
 
-	/** \fn void gxBindUniformBlock(uint32_t binding_point, uint32_t ubo)
-	 *  \brief Binds a Uniform Block to a specific binding point for a shader.
-	 *  \param binding_point Binding point index to bind the buffer to
-	 *  \param ubo Uniform Buffer Object id to bind
+	/** \fn bool gxSoftwareDraw(GXSoftwareRenderer* renderer, const GXSoftwareDraw* draw)
+	 *  \brief Transforms, shades and bins triangles, they are rasterized by gxSoftwareFinish.
+	 *  \param renderer Software renderer
+	 *  \param draw Triangles to draw, the vertex and index data is not referenced after the call
+	 *  \return true if the draw was queued, false on an unsupported primitive or layout.
+	 *  \note Large draws rasterize the triangles queued so far early to bound memory use.
 	 */
-	GX_API void gxBindUniformBlock(uint32_t binding_point, uint32_t ubo);
+	GX_API bool gxSoftwareDraw(GXSoftwareRenderer* renderer, const GXSoftwareDraw* draw);
 
-	/** \fn void gxUseShader(GXObject* object)
-	 *  \brief Tells the program to use the shader associated with the object.
-	 *  \param object Pointer to GXObject and therefore its shader
+	/** \fn void gxSoftwareFinish(GXSoftwareRenderer* renderer)
+	 *  \brief Rasterizes the queued triangles into `pixels` and `depth`.
+	 *  \param renderer Software renderer
 	 */
-	GX_API void gxUseShader(GXObject* object);
+	GX_API void gxSoftwareFinish(GXSoftwareRenderer* renderer);
+
+	/** \fn bool gxRenderServe(const GXRenderServerOptions* options, GXRenderServerStats* out_stats)
+	 *  \brief Serves render jobs with the current context until a client sends `quit` or stdin is closed.
+	 *  \param options Server configuration
+	 *  \param out_stats Counters when the server stopped, may be nullptr
+	 *  \return true if the server ran, false if the socket could not be opened.
+	 *
+	 *  The process, its context and everything the callback keeps in `user_data` (compiled programs, uploaded meshes and
+	 *  textures) outlive the jobs, so only the first job pays for initialization. Job targets come from the transient
+	 *  render target pool and every job counts as a frame for its idle eviction.
+	 *
+	 *  Jobs are requested one per line and answered in order, one line per request:
+	 *  - `render <width> <height> <output> [scene]`: answered with `ok <id> <latency ms>` or `error <id> <message>`, the
+	 *    output is PNG for ".png" paths, binary PPM for ".ppm" paths and top-to-bottom RGBA8 otherwise
+	 *  - `stats`: answered with `stats <completed> <failed> <jobs/s> <p50 ms> <p90 ms> <p99 ms> <max ms>`
+	 *  - `quit`: answered with `bye`, stops the server
+	 *
+	 *  \note Unix sockets are not supported on Windows, jobs are only read from stdin there.
+	 *
+	 *  \code
+	 *  gxCreateApplication(GX_APP_OPTION_HEADLESS);
+	 *  GXWindow* context = gxCreateWindow(false, false, 1, 1, "render server");
+	 *  Renderer renderer;  // Programs and assets, loaded on first use
+	 *  GXRenderServerOptions options = { "/tmp/gx.sock", {}, render_report, &renderer };
+	 *  gxRenderServe(&options, nullptr);
+	 *  // $ echo "render 1280 720 chart.png reports/q3.json" | socat - UNIX-CONNECT:/tmp/gx.sock
+	 *  \endcode
+	 */
+	GX_API bool gxRenderServe(const GXRenderServerOptions* options, GXRenderServerStats* out_stats);
+
+	/** \fn void gxGpuScopeBegin(const char* name)
+	 *  \brief Opens a named GPU profiler scope in the current context, scopes nest.
+	 *  \param name Scope name
+	 *
+	 *  Scopes write GL_TIMESTAMP queries, taken from a pool of the current context, into the command stream. Their
+	 *  results are read without waiting a few frames later by gxResolveGpuScopes, which gxExec calls for every window
+	 *  before its draw callback. Render graph passes are profiled under their names.
+	 *
+	 *  Use the GX_GPU_SCOPE_BEGIN and GX_GPU_SCOPE_END macros to remove profiling from builds without
+	 *  GX_ENABLE_GPU_PROFILER (CMake option of the same name).
+	 *
+	 *  \code
+	 *  GX_GPU_SCOPE_BEGIN("frame");
+	 *  GX_GPU_SCOPE_BEGIN("shadows");
+	 *  draw_shadows();
+	 *  GX_GPU_SCOPE_END();
+	 *  draw_scene();
+	 *  GX_GPU_SCOPE_END();
+	 *  \endcode
+	 *  \see gxGpuScopeEnd()
+	 */
+	GX_API void gxGpuScopeBegin(const char* name);
+
+	/** \fn void gxGpuScopeEnd()
+	 *  \brief Closes the innermost GPU profiler scope of the current context.
+	 *  \see gxGpuScopeBegin()
+	 */
+	GX_API void gxGpuScopeEnd();
+
+#if defined(GX_ENABLE_GPU_PROFILER)
+#define GX_GPU_SCOPE_BEGIN(name) gxGpuScopeBegin(name)
+#define GX_GPU_SCOPE_END() gxGpuScopeEnd()
+#else
+#define GX_GPU_SCOPE_BEGIN(name) ((void)0)
+#define GX_GPU_SCOPE_END() ((void)0)
+#endif
+
+	/** \fn void gxResolveGpuScopes()
+	 *  \brief Adds the finished scope samples of the current context to their scope, never waits for the GPU.
+	 *  \note Only needed by applications drawing outside of gxExec.
+	 */
+	GX_API void gxResolveGpuScopes();
+
+	/** \fn size_t gxGetGpuScopeStats(GXGpuScopeStats* out_stats, size_t capacity)
+	 *  \brief Copies the statistics of the scopes with resolved samples, in the order the scopes were first opened.
+	 *  \param out_stats Output array, may be nullptr to query the count
+	 *  \param capacity Capacity of `out_stats`
+	 *  \return Number of scopes with resolved samples.
+	 *  \note Scopes are never removed, their names stay valid.
+	 */
+	GX_API size_t gxGetGpuScopeStats(GXGpuScopeStats* out_stats, size_t capacity);
+
+	/** \fn void gxResetGpuScopeStats()
+	 *  \brief Clears the samples of every scope.
+	 */
+	GX_API void gxResetGpuScopeStats();
+
+	/** \fn size_t gxDumpGpuScopes(char* buffer, size_t size)
+	 *  \brief Formats the scope statistics as a text table, nested scopes indented under their parent.
+	 *  \param buffer Output buffer, always null terminated when `size` is not 0
+	 *  \param size Size of `buffer` in bytes
+	 *  \return Length of the full table without the terminator, as snprintf.
+	 *
+	 *  \code
+	 *  std::string table(gxDumpGpuScopes(nullptr, 0), '\0');
+	 *  gxDumpGpuScopes(table.data(), table.size() + 1);
+	 *  \endcode
+	 */
+	GX_API size_t gxDumpGpuScopes(char* buffer, size_t size);
 
 #ifdef __cplusplus
 }